@@ -310,28 +310,78 @@ fshandler handlers[] = {
 };
 #define NHANDLERS (sizeof(handlers)/sizeof(handlers[0]))
 
+// Requests that may be sent with ipc_call_mr instead of an argument
+// page.  Their body fits in the message words and they reply with
+// nothing but the result.
+static bool
+short_request(uint32_t req)
+{
+	return req == FSREQ_FLUSH || req == FSREQ_SET_SIZE || req == FSREQ_SYNC;
+}
+
+// Body of the current short request.
+static union Fsipc shortreq;
+
 void
 serve(void)
 {
-	uint32_t req, whom;
-	int perm, r;
+	uint32_t req, whom, client;
+	int perm, reply_perm, r;
+	bool short_reply;
 	void *pg;
 
+	// The reply to each request is sent together with the wait
+	// for the next one.  Nothing is sent on the first iteration
+	// and after invalid requests.  A short request gets a short
+	// reply, which carries no page.
+	whom = 0;
+	r = 0;
+	pg = NULL;
+	perm = 0;
+	short_reply = false;
 	while (1) {
-		perm = 0;
-		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+		client = whom;
+		reply_perm = perm;
+		if (short_reply)
+			req = ipc_reply_wait_mr(client, r, 0, 0, 0,
+						(int32_t *) &whom, &perm);
+		else
+			req = ipc_reply_wait(client, r, pg, reply_perm,
+					     (int32_t *) &whom, fsreq, &perm);
+		short_reply = false;
+		if ((int32_t) req == -E_IPC_NOT_RECV) {
+			// The client used ipc_send instead of ipc_call and
+			// is not in ipc_recv yet: wait for it to get there.
+			sys_ipc_send(client, r, pg ? pg : (void *) UTOP,
+				     reply_perm);
+			whom = 0;
+			continue;
+		}
+		if ((int32_t) req < 0) {
+			// The client went away before we could reply.
+			whom = 0;
+			continue;
+		}
 		if (debug)
 			cprintf("fs req %d from %08x [page %08x: %s]\n",
 				req, whom, uvpt[PGNUM(fsreq)], (char *) fsreq);
 
-		// All requests must contain an argument page
+		pg = NULL;
 		if (!(perm & PTE_P)) {
-			cprintf("Invalid request from %08x: no argument page\n",
-				whom);
-			continue; // just leave it hanging...
+			// A short request: its body came in the message words.
+			if (!short_request(req)) {
+				cprintf("Invalid request from %08x: no argument page\n",
+					whom);
+				whom = 0;
+				continue; // just leave it hanging...
+			}
+			memcpy(&shortreq, (void *) &thisenv->env_ipc_mr[1],
+			       sizeof(thisenv->env_ipc_mr) - sizeof(uint32_t));
+			r = handlers[req](whom, &shortreq);
+			short_reply = true;
+			continue;
 		}
 
-		pg = NULL;
 		if (req == FSREQ_OPEN) {
 			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
 		} else if (req < NHANDLERS && handlers[req]) {
@@ -340,7 +390,6 @@ serve(void)
 			cprintf("Invalid request code %d from %08x\n", req, whom);
 			r = -E_INVAL;
 		}
-		ipc_send(whom, r, pg, perm);
 		sys_page_unmap(0, fsreq);
 	}
 }
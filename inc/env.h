@@ -38,6 +38,24 @@ enum {
 	ENV_NOT_RUNNABLE
 };
 
+// Scheduling priority levels.  Every level has its own run queue,
+// and the scheduler always picks from the highest non-empty one.
+#define NENVPRIO		32
+#define ENV_PRIO_IDLE		0
+#define ENV_PRIO_DEFAULT	16
+#define ENV_PRIO_MAX		(NENVPRIO - 1)
+
+// Number of words carried in registers by an IPC message.
+// Word 0 is the classic IPC value.
+#define IPC_NMR			4
+
+// Nice values select an env's weight for fair sharing of the CPU within
+// its priority level: each nice step is worth about 10% of CPU time.
+// System environments (e.g. the file server) default to ENV_NICE_SYSTEM.
+#define ENV_NICE_MIN		(-20)
+#define ENV_NICE_MAX		19
+#define ENV_NICE_SYSTEM		(-5)
+
 // Special environment types
 enum EnvType {
 	ENV_TYPE_IDLE = 0,
@@ -56,15 +74,49 @@ struct Env {
 	uint32_t env_runs;		// Number of times environment has run
 	pde_t *env_pgdir;		// Kernel virtual address of page dir
 
+	// Scheduling
+	uint32_t env_priority;		// Run queue this env is placed on
+	uint32_t env_rq_index;		// Position in the run queue heap
+	uint32_t env_rq_seq;		// Queueing order, breaks vruntime ties
+	int32_t env_nice;		// Nice value, ENV_NICE_MIN..ENV_NICE_MAX
+	uint32_t env_weight;		// Share of CPU derived from env_nice
+	uint64_t env_vruntime;		// Weighted CPU time, orders the run queue
+	uint64_t env_cputime;		// Total CPU time used, in TSC cycles
+
 	// Exception handling
 	void *env_pgfault_upcall;	// Page fault upcall entry point
+	bool env_kcow;			// Kernel resolves PTE_COW write faults
 
 	// Lab 9 IPC
 	bool env_ipc_recving;		// Env is blocked receiving
+	envid_t env_ipc_recv_from;	// Only accept messages from this env, 0 = any
 	void *env_ipc_dstva;		// VA at which to map received page
 	uint32_t env_ipc_value;		// Data value sent to us
+	uint32_t env_ipc_mr[IPC_NMR];	// Message words sent to us, [0] == value
 	envid_t env_ipc_from;		// envid of the sender
 	int env_ipc_perm;		// Perm of page mapping received
+
+	// Blocking IPC send
+	struct Env *env_ipc_senders;	// FIFO of envs blocked sending to us
+	struct Env *env_ipc_senders_tail; // Last env on env_ipc_senders
+	struct Env *env_ipc_send_next;	// Next env on the target's FIFO
+	struct Env *env_ipc_send_to;	// Env we are blocked sending to
+	uint32_t env_ipc_send_mr[IPC_NMR]; // Message words we are blocked sending
+	void *env_ipc_send_srcva;	// Page we are blocked sending
+	unsigned env_ipc_send_perm;	// Perm of the page we are sending
+	bool env_ipc_send_call;		// Wait for a reply once the send is taken
+
+	// Waiting for a reply (sys_ipc_call)
+	struct Env *env_ipc_callers;	// Envs waiting for our reply
+	struct Env *env_ipc_call_next;	// Next env on the server's list
+	struct Env *env_ipc_call_to;	// Env we are waiting for a reply from
+
+	// Notification (sys_notify_wait)
+	physaddr_t env_notify_pa;	// Word we are waiting on, 0 if none
+	struct Env *env_notify_next;	// Next waiter in the same hash bucket
+
+	// System call ring (sys_ring_setup)
+	struct PageInfo *env_sysring;	// Ring page, NULL if none
 };
 
 #endif // !JOS_INC_ENV_H
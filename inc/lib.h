@@ -41,6 +41,7 @@ extern const volatile int vsys[];
 extern const volatile struct Env *thisenv;
 extern const volatile struct Env envs[NENV];
 extern const volatile struct PageInfo pages[];
+extern const volatile struct SyscallStats sysstats[NSYSCALLS];
 
 // exit.c
 void	exit(void);
@@ -58,18 +59,40 @@ envid_t	sys_getenvid(void);
 int	sys_env_destroy(envid_t);
 void	sys_yield(void);
 static envid_t sys_exofork(void);
+envid_t	sys_fork(void);
 int	sys_env_set_status(envid_t env, int status);
+int	sys_env_set_kcow(envid_t env, int enable);
+int	sys_env_set_nice(envid_t env, int nice);
 int	sys_env_set_trapframe(envid_t env, struct Trapframe *tf);
 int	sys_env_set_pgfault_upcall(envid_t env, void *upcall);
 int	sys_page_alloc(envid_t env, void *pg, int perm);
 int	sys_page_map(envid_t src_env, void *src_pg,
 		     envid_t dst_env, void *dst_pg, int perm);
 int	sys_page_unmap(envid_t env, void *pg);
+int	sys_page_map_batch(const struct PageOp *ops, size_t n);
 int	sys_ipc_try_send(envid_t to_env, uint32_t value, void *pg, int perm);
+int	sys_ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
+int	sys_ipc_call(envid_t to_env, uint32_t value, void *pg, int perm,
+		     void *rcv_pg);
+int	sys_ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, int perm,
+			   void *rcv_pg);
+int	sys_ipc_call_mr(envid_t to_env, uint32_t w0, uint32_t w1, uint32_t w2,
+			uint32_t w3);
+int	sys_ipc_reply_wait_mr(envid_t to_env, uint32_t w0, uint32_t w1,
+			      uint32_t w2, uint32_t w3);
 int	sys_ipc_recv(void *rcv_pg);
+int	sys_notify_wait(uint32_t *uaddr, uint32_t expected);
+int	sys_notify_wake(uint32_t *uaddr);
+int	sys_ring_setup(struct SysRing *r);
+int	sys_ring_enter(uint32_t to_submit, uint32_t min_complete);
 int sys_gettime(void);
 
 int vsys_gettime(void);
+uint32_t vsys_tsc_khz(void);
+uint64_t vsys_monotonic_ns(void);
+uint64_t vsys_wallclock_ns(void);
+uint32_t vsys_ticks(void);
+envid_t vsys_cpu_envid(int cpu);
 
 // This must be inlined.  Exercise for reader: why?
 static __inline envid_t __attribute__((always_inline))
@@ -87,10 +110,18 @@ sys_exofork(void)
 // ipc.c
 void	ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+int32_t ipc_call(envid_t to_env, uint32_t value, void *pg, int perm,
+		 void *rcv_pg, int *perm_store);
+int32_t ipc_reply_wait(envid_t to_env, uint32_t value, void *pg, int perm,
+		       envid_t *from_env_store, void *rcv_pg, int *perm_store);
+int32_t ipc_call_mr(envid_t to_env, uint32_t w0, uint32_t w1, uint32_t w2,
+		    uint32_t w3);
+int32_t ipc_reply_wait_mr(envid_t to_env, uint32_t w0, uint32_t w1,
+			  uint32_t w2, uint32_t w3,
+			  envid_t *from_env_store, int *perm_store);
 envid_t	ipc_find_env(enum EnvType type);
 
 // fork.c
-#define	PTE_SHARE	0x400
 envid_t	fork(void);
 envid_t	sfork(void);	// Challenge!
 
@@ -129,6 +160,19 @@ int	opencons(void);
 int	pipe(int pipefds[2]);
 int	pipeisclosed(int pipefd);
 
+// ring.c
+struct Ring;
+int	ring_create(struct Ring *r, size_t npages);
+ssize_t	ring_write(struct Ring *r, const void *buf, size_t n);
+ssize_t	ring_read(struct Ring *r, void *buf, size_t n);
+void	ring_close(struct Ring *r);
+
+// sysring.c
+int	sysring_prep(struct SysRing *r, uint32_t num, uint32_t a1, uint32_t a2,
+		     uint32_t a3, uint32_t a4, uint32_t a5, uint32_t data);
+int	sysring_submit(struct SysRing *r, uint32_t min_complete);
+bool	sysring_reap(struct SysRing *r, struct SysRingCQE *cqe);
+
 // wait.c
 void	wait(envid_t env);
 
@@ -50,6 +50,8 @@
  *    UVPT      ---->  +------------------------------+ 0xdf400000
  *                     |          RO PAGES            | R-/R-  PTSIZE
  *    UPAGES    ---->  +------------------------------+ 0xdf000000
+ *                     |        RO SYSCALL STATS      | R-/R-  PGSIZE
+ *    USYSSTATS ---->  +------------------------------+ 0xdefff000
  *                     |           RO ENVS            | R-/R-  PTSIZE
  * UTOP,UENVS ------>  +------------------------------+ 0xdec00000
  * UXSTACKTOP -/       |     User Exception Stack     | RW/RW  PGSIZE
@@ -93,6 +95,9 @@
 #define IOPHYSMEM	0x0A0000
 #define EXTPHYSMEM	0x100000
 
+// Physical address of startup code for non-boot CPUs (APs)
+#define MPENTRY_PADDR	0x7000
+
 // Amount of memory mapped by entrypgdir.
 #define BOOTMEMSIZE (12*1024*1024)
 
@@ -118,6 +123,9 @@
 #define UPAGES		(UVPT - PTSIZE)
 // Read-only copies of the global env structures
 #define UENVS		(UPAGES - PTSIZE)
+// Read-only system call statistics, in the last page of the UENVS
+// region, past the end of the envs array
+#define USYSSTATS	(UPAGES - PGSIZE)
 // Read-only virtual syscall space
 // LAB 12: Your code here.
 #define UVSYS       0xdebfe000
@@ -205,6 +213,14 @@ struct PageInfo {
 	// boot_alloc do not have valid reference count fields.
 
 	uint16_t pp_ref;
+
+	// Set on the first page of each free block of the buddy
+	// allocator, along with the block's order (log2 of its size in
+	// pages).  pp_link and pp_prev then link the block into the free
+	// list for that order.
+	uint8_t pp_free;
+	uint8_t pp_order;
+	struct PageInfo *pp_prev;
 };
 
 #endif /* !__ASSEMBLER__ */
@@ -69,6 +69,10 @@
 // hardware, so user processes are allowed to set them arbitrarily.
 #define PTE_AVAIL	0xE00	// Available for software use
 
+// Software PTE bits with a fixed meaning across user space and kernel.
+#define PTE_SHARE	0x400	// Shared with children by fork and spawn
+#define PTE_COW		0x800	// Copy-on-write
+
 // Flags in PTE_SYSCALL may be used in system calls.  (Others may not.)
 #define PTE_SYSCALL	(PTE_AVAIL | PTE_P | PTE_W | PTE_U)
 
@@ -89,6 +93,7 @@
 #define CR0_PG		0x80000000	// Paging
 
 #define CR4_PCE		0x00000100	// Performance counter enable
+#define CR4_PGE		0x00000080	// Page Global Enable
 #define CR4_MCE		0x00000040	// Machine Check Enable
 #define CR4_PSE		0x00000010	// Page Size Extensions
 #define CR4_DE		0x00000008	// Debugging Extensions
@@ -96,6 +101,14 @@
 #define CR4_PVI		0x00000002	// Protected-Mode Virtual Interrupts
 #define CR4_VME		0x00000001	// V86 Mode Extensions
 
+// Model-specific registers used by SYSENTER
+#define MSR_IA32_SYSENTER_CS	0x174	// Kernel code segment
+#define MSR_IA32_SYSENTER_ESP	0x175	// Kernel stack pointer
+#define MSR_IA32_SYSENTER_EIP	0x176	// Kernel entry point
+
+// CPUID function 1 feature flags in EDX
+#define CPUID_FEAT_SEP		0x00000800	// SYSENTER/SYSEXIT
+
 // Eflags register
 #define FL_CF		0x00000001	// Carry Flag
 #define FL_PF		0x00000004	// Parity Flag
@@ -1,6 +1,8 @@
 #ifndef JOS_INC_SYSCALL_H
 #define JOS_INC_SYSCALL_H
 
+#include <inc/types.h>
+
 /* system call numbers */
 enum {
 	SYS_cputs = 0,
@@ -18,7 +20,83 @@ enum {
 	SYS_ipc_try_send,
 	SYS_ipc_recv,
 	SYS_gettime,
+	SYS_env_set_nice,
+	SYS_ipc_send,
+	SYS_ipc_call,
+	SYS_ipc_reply_wait,
+	SYS_ipc_call_mr,
+	SYS_ipc_reply_wait_mr,
+	SYS_notify_wait,
+	SYS_notify_wake,
+	SYS_fork,
+	SYS_env_set_kcow,
+	SYS_page_map_batch,
+	SYS_ring_setup,
+	SYS_ring_enter,
 	NSYSCALLS
 };
 
+/* operations for SYS_page_map_batch */
+enum {
+	PAGEOP_ALLOC = 0,	// sys_page_alloc(dstenv, dstva, perm)
+	PAGEOP_MAP,		// sys_page_map(srcenv, srcva, dstenv, dstva, perm)
+	PAGEOP_UNMAP,		// sys_page_unmap(dstenv, dstva)
+};
+
+struct PageOp {
+	int op;			// PAGEOP_*
+	int srcenv;		// envid_t, only for PAGEOP_MAP
+	void *srcva;		// only for PAGEOP_MAP
+	int dstenv;		// envid_t
+	void *dstva;
+	int perm;		// for PAGEOP_ALLOC and PAGEOP_MAP
+};
+
+// System call ring (sys_ring_setup, sys_ring_enter): one page shared by
+// an env and the kernel.  The env queues calls on the submission queue
+// and advances sq_tail; sys_ring_enter makes them, advances sq_head and
+// posts the result of each on the completion queue, which the env
+// consumes by advancing cq_head.  All four are free-running counters,
+// taken modulo the queue size to index the queue.
+#define SYSRING_NSQE	64
+#define SYSRING_NCQE	128
+
+struct SysRingSQE {
+	uint32_t sqe_num;		// system call number
+	uint32_t sqe_args[5];		// its arguments
+	uint32_t sqe_data;		// passed on to the completion
+	uint32_t sqe_pad;
+};
+
+struct SysRingCQE {
+	int32_t cqe_res;		// what the system call returned
+	uint32_t cqe_data;		// sqe_data of the submission
+};
+
+struct SysRing {
+	volatile uint32_t sq_head;	// next submission the kernel takes
+	volatile uint32_t sq_tail;	// next free submission slot
+	volatile uint32_t cq_head;	// next completion the env takes
+	volatile uint32_t cq_tail;	// next free completion slot
+	uint32_t r_pad[12];
+	struct SysRingSQE sq[SYSRING_NSQE];
+	struct SysRingCQE cq[SYSRING_NCQE];
+};
+
+// Statistics of one system call, kept by the kernel and mapped read-only
+// at USYSSTATS as an array indexed by system call number.
+// Bucket 0 of sc_hist counts the calls that took less than
+// 2^SYSHIST_SHIFT TSC cycles, bucket i > 0 those that took less than
+// 2^(SYSHIST_SHIFT + i) but more than the bucket before, and the last
+// bucket also everything longer.  Calls that blocked are in sc_count
+// but not in sc_hist or sc_cycles.
+#define SYSHIST_SHIFT	7
+#define NSYSHIST	13
+
+struct SyscallStats {
+	uint32_t sc_count;		// calls made
+	uint32_t sc_hist[NSYSHIST];	// latency histogram
+	uint64_t sc_cycles;		// total cycles of the timed calls
+} __attribute__((aligned(64)));
+
 #endif /* !JOS_INC_SYSCALL_H */
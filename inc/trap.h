@@ -39,6 +39,7 @@
 #define IRQ_CLOCK        8
 #define IRQ_IDE         14
 #define IRQ_ERROR       19
+#define IRQ_TLBFLUSH    20	// TLB shootdown IPI, see tlb_shootdown
 
 #ifndef __ASSEMBLER__
 
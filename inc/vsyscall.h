@@ -1,10 +1,33 @@
 #ifndef JOS_INC_VSYSCALL_H
 #define JOS_INC_VSYSCALL_H
 
-/* system call numbers */
+// Slots of the vsys page, which the kernel keeps up to date and every
+// environment can read at UVSYS without a system call.
+//
+// Time: monotonic nanoseconds since boot at TSC value 'tsc' are
+//	mono_base + (((rdtsc() - tsc_base) * tsc_mult) >> tsc_shift),
+// and wall-clock nanoseconds since the epoch are boot_ns plus that.
+// The kernel moves tsc_base and mono_base forward on every tick, and
+// bumps 'seq' to an odd value while it does so; a reader retries until
+// it sees the same even 'seq' before and after reading the fields.
+// 64-bit values take two slots, the low half first.
+//
+// VSYS_cpu_envid + i holds the id of the env running on the CPU with
+// local APIC id i (what CPUID reports), or 0 if that CPU is idle.
+#define VSYS_NCPU	8
+
 enum {
-	VSYS_gettime,
-	NVSYSCALLS
+	VSYS_gettime,		// wall-clock time in seconds
+	VSYS_tsc_khz,		// TSC frequency in kHz
+	VSYS_tsc_mult,		// TSC cycles to nanoseconds, multiplier
+	VSYS_tsc_shift,		// TSC cycles to nanoseconds, shift
+	VSYS_seq,		// sequence count of the time fields
+	VSYS_tsc_base,		// TSC value at the last tick (2 slots)
+	VSYS_mono_base = VSYS_tsc_base + 2,	// ns since boot at tsc_base (2 slots)
+	VSYS_boot_ns = VSYS_mono_base + 2,	// wall-clock ns at boot (2 slots)
+	VSYS_ticks = VSYS_boot_ns + 2,		// scheduler ticks since boot
+	VSYS_cpu_envid,		// current env of each CPU (VSYS_NCPU slots)
+	NVSYSCALLS = VSYS_cpu_envid + VSYS_NCPU
 };
 
 #endif /* !JOS_INC_VSYSCALL_H */
@@ -1,4 +1,3 @@
-
 #ifndef JOS_INC_CPU_H
 #define JOS_INC_CPU_H
 
@@ -7,12 +6,62 @@
 #include <inc/mmu.h>
 #include <inc/env.h>
 
-#define NCPU 1
+// Maximum number of CPUs
+#define NCPU  8
+
+// Values of status in struct Cpu
+enum {
+	CPU_UNUSED = 0,
+	CPU_STARTED,
+	CPU_HALTED,
+};
+
+// Address spaces and pages a CPU can hold back between tlb_defer_begin
+// and tlb_defer_end (see kern/pmap.c).
+#define TLB_DEFER_NPGDIR	4
+#define TLB_DEFER_NPAGE		32
+
+// Per-CPU state
+struct CpuInfo {
+	uint8_t cpu_id;                 // Local APIC ID; index into cpus[] below
+	volatile unsigned cpu_status;   // The status of the CPU
+	struct Env *cpu_env;            // The currently-running environment.
+	struct Taskstate cpu_ts;        // Used by x86 to find stack for interrupt
+	bool cpu_kernel_locked;         // This CPU holds the big kernel lock
+	int cpu_tlb_defer;              // Nesting depth of tlb_defer_begin
+	bool cpu_tlb_pending;           // A TLB flush was deferred
+	physaddr_t cpu_cr3;             // Page directory loaded by pgdir_load
+	volatile bool cpu_tlb_shoot;    // Another CPU waits for us to flush the TLB
+	pde_t *cpu_tlb_shoot_pgdirs[TLB_DEFER_NPGDIR]; // Deferred shootdowns
+	int cpu_tlb_nshoot;
+	struct PageInfo *cpu_tlb_free[TLB_DEFER_NPAGE]; // Pages freed after them
+	int cpu_tlb_nfree;
+};
 
-extern struct Taskstate cpu_ts;        // Used by x86 to find stack for interrupt
+// Initialized in mpconfig.c
+extern struct CpuInfo cpus[NCPU];
+extern int ncpu;                    // Total number of CPUs in the system
+extern struct CpuInfo *bootcpu;     // The boot-strap processor (BSP)
+extern physaddr_t lapicaddr;        // Physical MMIO address of the local APIC
+
+// Per-CPU kernel stacks
+extern unsigned char percpu_kstacks[NCPU][KSTKSIZE];
+
+int cpunum(void);
+#define thiscpu (&cpus[cpunum()])
+
+void mp_init(void);
+// Scheduler ticks per second.  The local APIC timer of every CPU
+// interrupts this often.  Set with 'make HZ=...'.
+#ifndef HZ
+#define HZ 100
+#endif
 
-//kernel stack
-extern unsigned char kstack[KSTKSIZE];
+void lapic_init(void);
+void lapic_startap(uint8_t apicid, uint32_t addr);
+void lapic_eoi(void);
+void lapic_ipi(int vector);
+void lapic_ipi_cpu(uint8_t apicid, int vector);
 
 extern char in_intr;
 extern bool in_clk_intr;
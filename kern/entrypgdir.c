@@ -1,9 +1,6 @@
 #include <inc/mmu.h>
 #include <inc/memlayout.h>
 
-pte_t entry_pgtable0[NPTENTRIES];
-pte_t entry_pgtable1[NPTENTRIES];
-pde_t entry_pgtable2[NPTENTRIES];
 #ifdef SANITIZE_SHADOW_BASE
 pte_t san_pgtable0[NPTENTRIES];
 pte_t san_pgtable1[NPTENTRIES];
@@ -13,14 +10,13 @@ pte_t san_pgtable4[NPTENTRIES];
 pte_t san_pgtable5[NPTENTRIES];
 #endif
 
-// The entry.S page directory maps the first 8MB of physical memory
+// The entry.S page directory maps the first 12MB of physical memory
 // starting at virtual address KERNBASE (that is, it maps virtual
-// addresses [KERNBASE, KERNBASE+8MB) to physical addresses [0, 8MB)).
-// We choose 8MB because that's how much we can map with two page
-// tables and it's enough to get us through early boot.  We also map
-// virtual addresses [0, 4MB) to physical addresses [0, 4MB); this
-// region is critical for a few instructions in entry.S and then we
-// never use it again.
+// addresses [KERNBASE, KERNBASE+12MB) to physical addresses [0, 12MB)).
+// It does so with three 4MB pages, so entry.S (and mpentry.S) must
+// turn on CR4_PSE before paging.  We also map virtual addresses
+// [0, 4MB) to physical addresses [0, 4MB); this region is critical
+// for a few instructions in entry.S and then we never use it again.
 //
 // Page directories (and page tables), must start on a page boundary,
 // hence the "__aligned__" attribute.  Also, because of restrictions
@@ -31,14 +27,14 @@ __attribute__((__aligned__(PGSIZE)))
 pde_t entry_pgdir[NPDENTRIES] = {
 	// Map VA's [0, 4MB) to PA's [0, 4MB)
 	[0]
-		= ((uintptr_t)entry_pgtable0 - KERNBASE) + PTE_P,
+		= 0x000000 + PTE_P + PTE_PS,
 	// Map VA's [KERNBASE, KERNBASE+12MB) to PA's [0, 12MB)
 	[KERNBASE>>PDXSHIFT]
-		= ((uintptr_t)entry_pgtable0 - KERNBASE) + PTE_P + PTE_W,
+		= 0x000000 + PTE_P + PTE_W + PTE_PS,
 	[(KERNBASE>>PDXSHIFT) + 1]
-		= ((uintptr_t)entry_pgtable1 - KERNBASE) + PTE_P + PTE_W,
+		= 0x400000 + PTE_P + PTE_W + PTE_PS,
 	[(KERNBASE>>PDXSHIFT) + 2]
-		= ((uintptr_t)entry_pgtable2 - KERNBASE) + PTE_P + PTE_W,
+		= 0x800000 + PTE_P + PTE_W + PTE_PS,
 #ifdef SANITIZE_SHADOW_BASE
 	// If we have sanitizers, include the shadow in the mapping: [0, 12MB)
 	[SANITIZE_SHADOW_BASE>>PDXSHIFT]
@@ -63,3094 +59,6 @@ pde_t entry_pgdir[NPDENTRIES] = {
 #endif
 
 _Static_assert(BOOTMEMSIZE == 12*1024*1024, "You forgot to update BOOTMEMSIZE to reflect real boot memory size!");
-
-// Entry 0 of the page table maps to physical page 0, entry 1 to
-// physical page 1, etc.
-__attribute__((__aligned__(PGSIZE)))
-pte_t entry_pgtable0[NPTENTRIES] = {
-	0x000000,
-	0x001000 | PTE_P | PTE_W,
-	0x002000 | PTE_P | PTE_W,
-	0x003000 | PTE_P | PTE_W,
-	0x004000 | PTE_P | PTE_W,
-	0x005000 | PTE_P | PTE_W,
-	0x006000 | PTE_P | PTE_W,
-	0x007000 | PTE_P | PTE_W,
-	0x008000 | PTE_P | PTE_W,
-	0x009000 | PTE_P | PTE_W,
-	0x00a000 | PTE_P | PTE_W,
-	0x00b000 | PTE_P | PTE_W,
-	0x00c000 | PTE_P | PTE_W,
-	0x00d000 | PTE_P | PTE_W,
-	0x00e000 | PTE_P | PTE_W,
-	0x00f000 | PTE_P | PTE_W,
-	0x010000 | PTE_P | PTE_W,
-	0x011000 | PTE_P | PTE_W,
-	0x012000 | PTE_P | PTE_W,
-	0x013000 | PTE_P | PTE_W,
-	0x014000 | PTE_P | PTE_W,
-	0x015000 | PTE_P | PTE_W,
-	0x016000 | PTE_P | PTE_W,
-	0x017000 | PTE_P | PTE_W,
-	0x018000 | PTE_P | PTE_W,
-	0x019000 | PTE_P | PTE_W,
-	0x01a000 | PTE_P | PTE_W,
-	0x01b000 | PTE_P | PTE_W,
-	0x01c000 | PTE_P | PTE_W,
-	0x01d000 | PTE_P | PTE_W,
-	0x01e000 | PTE_P | PTE_W,
-	0x01f000 | PTE_P | PTE_W,
-	0x020000 | PTE_P | PTE_W,
-	0x021000 | PTE_P | PTE_W,
-	0x022000 | PTE_P | PTE_W,
-	0x023000 | PTE_P | PTE_W,
-	0x024000 | PTE_P | PTE_W,
-	0x025000 | PTE_P | PTE_W,
-	0x026000 | PTE_P | PTE_W,
-	0x027000 | PTE_P | PTE_W,
-	0x028000 | PTE_P | PTE_W,
-	0x029000 | PTE_P | PTE_W,
-	0x02a000 | PTE_P | PTE_W,
-	0x02b000 | PTE_P | PTE_W,
-	0x02c000 | PTE_P | PTE_W,
-	0x02d000 | PTE_P | PTE_W,
-	0x02e000 | PTE_P | PTE_W,
-	0x02f000 | PTE_P | PTE_W,
-	0x030000 | PTE_P | PTE_W,
-	0x031000 | PTE_P | PTE_W,
-	0x032000 | PTE_P | PTE_W,
-	0x033000 | PTE_P | PTE_W,
-	0x034000 | PTE_P | PTE_W,
-	0x035000 | PTE_P | PTE_W,
-	0x036000 | PTE_P | PTE_W,
-	0x037000 | PTE_P | PTE_W,
-	0x038000 | PTE_P | PTE_W,
-	0x039000 | PTE_P | PTE_W,
-	0x03a000 | PTE_P | PTE_W,
-	0x03b000 | PTE_P | PTE_W,
-	0x03c000 | PTE_P | PTE_W,
-	0x03d000 | PTE_P | PTE_W,
-	0x03e000 | PTE_P | PTE_W,
-	0x03f000 | PTE_P | PTE_W,
-	0x040000 | PTE_P | PTE_W,
-	0x041000 | PTE_P | PTE_W,
-	0x042000 | PTE_P | PTE_W,
-	0x043000 | PTE_P | PTE_W,
-	0x044000 | PTE_P | PTE_W,
-	0x045000 | PTE_P | PTE_W,
-	0x046000 | PTE_P | PTE_W,
-	0x047000 | PTE_P | PTE_W,
-	0x048000 | PTE_P | PTE_W,
-	0x049000 | PTE_P | PTE_W,
-	0x04a000 | PTE_P | PTE_W,
-	0x04b000 | PTE_P | PTE_W,
-	0x04c000 | PTE_P | PTE_W,
-	0x04d000 | PTE_P | PTE_W,
-	0x04e000 | PTE_P | PTE_W,
-	0x04f000 | PTE_P | PTE_W,
-	0x050000 | PTE_P | PTE_W,
-	0x051000 | PTE_P | PTE_W,
-	0x052000 | PTE_P | PTE_W,
-	0x053000 | PTE_P | PTE_W,
-	0x054000 | PTE_P | PTE_W,
-	0x055000 | PTE_P | PTE_W,
-	0x056000 | PTE_P | PTE_W,
-	0x057000 | PTE_P | PTE_W,
-	0x058000 | PTE_P | PTE_W,
-	0x059000 | PTE_P | PTE_W,
-	0x05a000 | PTE_P | PTE_W,
-	0x05b000 | PTE_P | PTE_W,
-	0x05c000 | PTE_P | PTE_W,
-	0x05d000 | PTE_P | PTE_W,
-	0x05e000 | PTE_P | PTE_W,
-	0x05f000 | PTE_P | PTE_W,
-	0x060000 | PTE_P | PTE_W,
-	0x061000 | PTE_P | PTE_W,
-	0x062000 | PTE_P | PTE_W,
-	0x063000 | PTE_P | PTE_W,
-	0x064000 | PTE_P | PTE_W,
-	0x065000 | PTE_P | PTE_W,
-	0x066000 | PTE_P | PTE_W,
-	0x067000 | PTE_P | PTE_W,
-	0x068000 | PTE_P | PTE_W,
-	0x069000 | PTE_P | PTE_W,
-	0x06a000 | PTE_P | PTE_W,
-	0x06b000 | PTE_P | PTE_W,
-	0x06c000 | PTE_P | PTE_W,
-	0x06d000 | PTE_P | PTE_W,
-	0x06e000 | PTE_P | PTE_W,
-	0x06f000 | PTE_P | PTE_W,
-	0x070000 | PTE_P | PTE_W,
-	0x071000 | PTE_P | PTE_W,
-	0x072000 | PTE_P | PTE_W,
-	0x073000 | PTE_P | PTE_W,
-	0x074000 | PTE_P | PTE_W,
-	0x075000 | PTE_P | PTE_W,
-	0x076000 | PTE_P | PTE_W,
-	0x077000 | PTE_P | PTE_W,
-	0x078000 | PTE_P | PTE_W,
-	0x079000 | PTE_P | PTE_W,
-	0x07a000 | PTE_P | PTE_W,
-	0x07b000 | PTE_P | PTE_W,
-	0x07c000 | PTE_P | PTE_W,
-	0x07d000 | PTE_P | PTE_W,
-	0x07e000 | PTE_P | PTE_W,
-	0x07f000 | PTE_P | PTE_W,
-	0x080000 | PTE_P | PTE_W,
-	0x081000 | PTE_P | PTE_W,
-	0x082000 | PTE_P | PTE_W,
-	0x083000 | PTE_P | PTE_W,
-	0x084000 | PTE_P | PTE_W,
-	0x085000 | PTE_P | PTE_W,
-	0x086000 | PTE_P | PTE_W,
-	0x087000 | PTE_P | PTE_W,
-	0x088000 | PTE_P | PTE_W,
-	0x089000 | PTE_P | PTE_W,
-	0x08a000 | PTE_P | PTE_W,
-	0x08b000 | PTE_P | PTE_W,
-	0x08c000 | PTE_P | PTE_W,
-	0x08d000 | PTE_P | PTE_W,
-	0x08e000 | PTE_P | PTE_W,
-	0x08f000 | PTE_P | PTE_W,
-	0x090000 | PTE_P | PTE_W,
-	0x091000 | PTE_P | PTE_W,
-	0x092000 | PTE_P | PTE_W,
-	0x093000 | PTE_P | PTE_W,
-	0x094000 | PTE_P | PTE_W,
-	0x095000 | PTE_P | PTE_W,
-	0x096000 | PTE_P | PTE_W,
-	0x097000 | PTE_P | PTE_W,
-	0x098000 | PTE_P | PTE_W,
-	0x099000 | PTE_P | PTE_W,
-	0x09a000 | PTE_P | PTE_W,
-	0x09b000 | PTE_P | PTE_W,
-	0x09c000 | PTE_P | PTE_W,
-	0x09d000 | PTE_P | PTE_W,
-	0x09e000 | PTE_P | PTE_W,
-	0x09f000 | PTE_P | PTE_W,
-	0x0a0000 | PTE_P | PTE_W,
-	0x0a1000 | PTE_P | PTE_W,
-	0x0a2000 | PTE_P | PTE_W,
-	0x0a3000 | PTE_P | PTE_W,
-	0x0a4000 | PTE_P | PTE_W,
-	0x0a5000 | PTE_P | PTE_W,
-	0x0a6000 | PTE_P | PTE_W,
-	0x0a7000 | PTE_P | PTE_W,
-	0x0a8000 | PTE_P | PTE_W,
-	0x0a9000 | PTE_P | PTE_W,
-	0x0aa000 | PTE_P | PTE_W,
-	0x0ab000 | PTE_P | PTE_W,
-	0x0ac000 | PTE_P | PTE_W,
-	0x0ad000 | PTE_P | PTE_W,
-	0x0ae000 | PTE_P | PTE_W,
-	0x0af000 | PTE_P | PTE_W,
-	0x0b0000 | PTE_P | PTE_W,
-	0x0b1000 | PTE_P | PTE_W,
-	0x0b2000 | PTE_P | PTE_W,
-	0x0b3000 | PTE_P | PTE_W,
-	0x0b4000 | PTE_P | PTE_W,
-	0x0b5000 | PTE_P | PTE_W,
-	0x0b6000 | PTE_P | PTE_W,
-	0x0b7000 | PTE_P | PTE_W,
-	0x0b8000 | PTE_P | PTE_W,
-	0x0b9000 | PTE_P | PTE_W,
-	0x0ba000 | PTE_P | PTE_W,
-	0x0bb000 | PTE_P | PTE_W,
-	0x0bc000 | PTE_P | PTE_W,
-	0x0bd000 | PTE_P | PTE_W,
-	0x0be000 | PTE_P | PTE_W,
-	0x0bf000 | PTE_P | PTE_W,
-	0x0c0000 | PTE_P | PTE_W,
-	0x0c1000 | PTE_P | PTE_W,
-	0x0c2000 | PTE_P | PTE_W,
-	0x0c3000 | PTE_P | PTE_W,
-	0x0c4000 | PTE_P | PTE_W,
-	0x0c5000 | PTE_P | PTE_W,
-	0x0c6000 | PTE_P | PTE_W,
-	0x0c7000 | PTE_P | PTE_W,
-	0x0c8000 | PTE_P | PTE_W,
-	0x0c9000 | PTE_P | PTE_W,
-	0x0ca000 | PTE_P | PTE_W,
-	0x0cb000 | PTE_P | PTE_W,
-	0x0cc000 | PTE_P | PTE_W,
-	0x0cd000 | PTE_P | PTE_W,
-	0x0ce000 | PTE_P | PTE_W,
-	0x0cf000 | PTE_P | PTE_W,
-	0x0d0000 | PTE_P | PTE_W,
-	0x0d1000 | PTE_P | PTE_W,
-	0x0d2000 | PTE_P | PTE_W,
-	0x0d3000 | PTE_P | PTE_W,
-	0x0d4000 | PTE_P | PTE_W,
-	0x0d5000 | PTE_P | PTE_W,
-	0x0d6000 | PTE_P | PTE_W,
-	0x0d7000 | PTE_P | PTE_W,
-	0x0d8000 | PTE_P | PTE_W,
-	0x0d9000 | PTE_P | PTE_W,
-	0x0da000 | PTE_P | PTE_W,
-	0x0db000 | PTE_P | PTE_W,
-	0x0dc000 | PTE_P | PTE_W,
-	0x0dd000 | PTE_P | PTE_W,
-	0x0de000 | PTE_P | PTE_W,
-	0x0df000 | PTE_P | PTE_W,
-	0x0e0000 | PTE_P | PTE_W,
-	0x0e1000 | PTE_P | PTE_W,
-	0x0e2000 | PTE_P | PTE_W,
-	0x0e3000 | PTE_P | PTE_W,
-	0x0e4000 | PTE_P | PTE_W,
-	0x0e5000 | PTE_P | PTE_W,
-	0x0e6000 | PTE_P | PTE_W,
-	0x0e7000 | PTE_P | PTE_W,
-	0x0e8000 | PTE_P | PTE_W,
-	0x0e9000 | PTE_P | PTE_W,
-	0x0ea000 | PTE_P | PTE_W,
-	0x0eb000 | PTE_P | PTE_W,
-	0x0ec000 | PTE_P | PTE_W,
-	0x0ed000 | PTE_P | PTE_W,
-	0x0ee000 | PTE_P | PTE_W,
-	0x0ef000 | PTE_P | PTE_W,
-	0x0f0000 | PTE_P | PTE_W,
-	0x0f1000 | PTE_P | PTE_W,
-	0x0f2000 | PTE_P | PTE_W,
-	0x0f3000 | PTE_P | PTE_W,
-	0x0f4000 | PTE_P | PTE_W,
-	0x0f5000 | PTE_P | PTE_W,
-	0x0f6000 | PTE_P | PTE_W,
-	0x0f7000 | PTE_P | PTE_W,
-	0x0f8000 | PTE_P | PTE_W,
-	0x0f9000 | PTE_P | PTE_W,
-	0x0fa000 | PTE_P | PTE_W,
-	0x0fb000 | PTE_P | PTE_W,
-	0x0fc000 | PTE_P | PTE_W,
-	0x0fd000 | PTE_P | PTE_W,
-	0x0fe000 | PTE_P | PTE_W,
-	0x0ff000 | PTE_P | PTE_W,
-	0x100000 | PTE_P | PTE_W,
-	0x101000 | PTE_P | PTE_W,
-	0x102000 | PTE_P | PTE_W,
-	0x103000 | PTE_P | PTE_W,
-	0x104000 | PTE_P | PTE_W,
-	0x105000 | PTE_P | PTE_W,
-	0x106000 | PTE_P | PTE_W,
-	0x107000 | PTE_P | PTE_W,
-	0x108000 | PTE_P | PTE_W,
-	0x109000 | PTE_P | PTE_W,
-	0x10a000 | PTE_P | PTE_W,
-	0x10b000 | PTE_P | PTE_W,
-	0x10c000 | PTE_P | PTE_W,
-	0x10d000 | PTE_P | PTE_W,
-	0x10e000 | PTE_P | PTE_W,
-	0x10f000 | PTE_P | PTE_W,
-	0x110000 | PTE_P | PTE_W,
-	0x111000 | PTE_P | PTE_W,
-	0x112000 | PTE_P | PTE_W,
-	0x113000 | PTE_P | PTE_W,
-	0x114000 | PTE_P | PTE_W,
-	0x115000 | PTE_P | PTE_W,
-	0x116000 | PTE_P | PTE_W,
-	0x117000 | PTE_P | PTE_W,
-	0x118000 | PTE_P | PTE_W,
-	0x119000 | PTE_P | PTE_W,
-	0x11a000 | PTE_P | PTE_W,
-	0x11b000 | PTE_P | PTE_W,
-	0x11c000 | PTE_P | PTE_W,
-	0x11d000 | PTE_P | PTE_W,
-	0x11e000 | PTE_P | PTE_W,
-	0x11f000 | PTE_P | PTE_W,
-	0x120000 | PTE_P | PTE_W,
-	0x121000 | PTE_P | PTE_W,
-	0x122000 | PTE_P | PTE_W,
-	0x123000 | PTE_P | PTE_W,
-	0x124000 | PTE_P | PTE_W,
-	0x125000 | PTE_P | PTE_W,
-	0x126000 | PTE_P | PTE_W,
-	0x127000 | PTE_P | PTE_W,
-	0x128000 | PTE_P | PTE_W,
-	0x129000 | PTE_P | PTE_W,
-	0x12a000 | PTE_P | PTE_W,
-	0x12b000 | PTE_P | PTE_W,
-	0x12c000 | PTE_P | PTE_W,
-	0x12d000 | PTE_P | PTE_W,
-	0x12e000 | PTE_P | PTE_W,
-	0x12f000 | PTE_P | PTE_W,
-	0x130000 | PTE_P | PTE_W,
-	0x131000 | PTE_P | PTE_W,
-	0x132000 | PTE_P | PTE_W,
-	0x133000 | PTE_P | PTE_W,
-	0x134000 | PTE_P | PTE_W,
-	0x135000 | PTE_P | PTE_W,
-	0x136000 | PTE_P | PTE_W,
-	0x137000 | PTE_P | PTE_W,
-	0x138000 | PTE_P | PTE_W,
-	0x139000 | PTE_P | PTE_W,
-	0x13a000 | PTE_P | PTE_W,
-	0x13b000 | PTE_P | PTE_W,
-	0x13c000 | PTE_P | PTE_W,
-	0x13d000 | PTE_P | PTE_W,
-	0x13e000 | PTE_P | PTE_W,
-	0x13f000 | PTE_P | PTE_W,
-	0x140000 | PTE_P | PTE_W,
-	0x141000 | PTE_P | PTE_W,
-	0x142000 | PTE_P | PTE_W,
-	0x143000 | PTE_P | PTE_W,
-	0x144000 | PTE_P | PTE_W,
-	0x145000 | PTE_P | PTE_W,
-	0x146000 | PTE_P | PTE_W,
-	0x147000 | PTE_P | PTE_W,
-	0x148000 | PTE_P | PTE_W,
-	0x149000 | PTE_P | PTE_W,
-	0x14a000 | PTE_P | PTE_W,
-	0x14b000 | PTE_P | PTE_W,
-	0x14c000 | PTE_P | PTE_W,
-	0x14d000 | PTE_P | PTE_W,
-	0x14e000 | PTE_P | PTE_W,
-	0x14f000 | PTE_P | PTE_W,
-	0x150000 | PTE_P | PTE_W,
-	0x151000 | PTE_P | PTE_W,
-	0x152000 | PTE_P | PTE_W,
-	0x153000 | PTE_P | PTE_W,
-	0x154000 | PTE_P | PTE_W,
-	0x155000 | PTE_P | PTE_W,
-	0x156000 | PTE_P | PTE_W,
-	0x157000 | PTE_P | PTE_W,
-	0x158000 | PTE_P | PTE_W,
-	0x159000 | PTE_P | PTE_W,
-	0x15a000 | PTE_P | PTE_W,
-	0x15b000 | PTE_P | PTE_W,
-	0x15c000 | PTE_P | PTE_W,
-	0x15d000 | PTE_P | PTE_W,
-	0x15e000 | PTE_P | PTE_W,
-	0x15f000 | PTE_P | PTE_W,
-	0x160000 | PTE_P | PTE_W,
-	0x161000 | PTE_P | PTE_W,
-	0x162000 | PTE_P | PTE_W,
-	0x163000 | PTE_P | PTE_W,
-	0x164000 | PTE_P | PTE_W,
-	0x165000 | PTE_P | PTE_W,
-	0x166000 | PTE_P | PTE_W,
-	0x167000 | PTE_P | PTE_W,
-	0x168000 | PTE_P | PTE_W,
-	0x169000 | PTE_P | PTE_W,
-	0x16a000 | PTE_P | PTE_W,
-	0x16b000 | PTE_P | PTE_W,
-	0x16c000 | PTE_P | PTE_W,
-	0x16d000 | PTE_P | PTE_W,
-	0x16e000 | PTE_P | PTE_W,
-	0x16f000 | PTE_P | PTE_W,
-	0x170000 | PTE_P | PTE_W,
-	0x171000 | PTE_P | PTE_W,
-	0x172000 | PTE_P | PTE_W,
-	0x173000 | PTE_P | PTE_W,
-	0x174000 | PTE_P | PTE_W,
-	0x175000 | PTE_P | PTE_W,
-	0x176000 | PTE_P | PTE_W,
-	0x177000 | PTE_P | PTE_W,
-	0x178000 | PTE_P | PTE_W,
-	0x179000 | PTE_P | PTE_W,
-	0x17a000 | PTE_P | PTE_W,
-	0x17b000 | PTE_P | PTE_W,
-	0x17c000 | PTE_P | PTE_W,
-	0x17d000 | PTE_P | PTE_W,
-	0x17e000 | PTE_P | PTE_W,
-	0x17f000 | PTE_P | PTE_W,
-	0x180000 | PTE_P | PTE_W,
-	0x181000 | PTE_P | PTE_W,
-	0x182000 | PTE_P | PTE_W,
-	0x183000 | PTE_P | PTE_W,
-	0x184000 | PTE_P | PTE_W,
-	0x185000 | PTE_P | PTE_W,
-	0x186000 | PTE_P | PTE_W,
-	0x187000 | PTE_P | PTE_W,
-	0x188000 | PTE_P | PTE_W,
-	0x189000 | PTE_P | PTE_W,
-	0x18a000 | PTE_P | PTE_W,
-	0x18b000 | PTE_P | PTE_W,
-	0x18c000 | PTE_P | PTE_W,
-	0x18d000 | PTE_P | PTE_W,
-	0x18e000 | PTE_P | PTE_W,
-	0x18f000 | PTE_P | PTE_W,
-	0x190000 | PTE_P | PTE_W,
-	0x191000 | PTE_P | PTE_W,
-	0x192000 | PTE_P | PTE_W,
-	0x193000 | PTE_P | PTE_W,
-	0x194000 | PTE_P | PTE_W,
-	0x195000 | PTE_P | PTE_W,
-	0x196000 | PTE_P | PTE_W,
-	0x197000 | PTE_P | PTE_W,
-	0x198000 | PTE_P | PTE_W,
-	0x199000 | PTE_P | PTE_W,
-	0x19a000 | PTE_P | PTE_W,
-	0x19b000 | PTE_P | PTE_W,
-	0x19c000 | PTE_P | PTE_W,
-	0x19d000 | PTE_P | PTE_W,
-	0x19e000 | PTE_P | PTE_W,
-	0x19f000 | PTE_P | PTE_W,
-	0x1a0000 | PTE_P | PTE_W,
-	0x1a1000 | PTE_P | PTE_W,
-	0x1a2000 | PTE_P | PTE_W,
-	0x1a3000 | PTE_P | PTE_W,
-	0x1a4000 | PTE_P | PTE_W,
-	0x1a5000 | PTE_P | PTE_W,
-	0x1a6000 | PTE_P | PTE_W,
-	0x1a7000 | PTE_P | PTE_W,
-	0x1a8000 | PTE_P | PTE_W,
-	0x1a9000 | PTE_P | PTE_W,
-	0x1aa000 | PTE_P | PTE_W,
-	0x1ab000 | PTE_P | PTE_W,
-	0x1ac000 | PTE_P | PTE_W,
-	0x1ad000 | PTE_P | PTE_W,
-	0x1ae000 | PTE_P | PTE_W,
-	0x1af000 | PTE_P | PTE_W,
-	0x1b0000 | PTE_P | PTE_W,
-	0x1b1000 | PTE_P | PTE_W,
-	0x1b2000 | PTE_P | PTE_W,
-	0x1b3000 | PTE_P | PTE_W,
-	0x1b4000 | PTE_P | PTE_W,
-	0x1b5000 | PTE_P | PTE_W,
-	0x1b6000 | PTE_P | PTE_W,
-	0x1b7000 | PTE_P | PTE_W,
-	0x1b8000 | PTE_P | PTE_W,
-	0x1b9000 | PTE_P | PTE_W,
-	0x1ba000 | PTE_P | PTE_W,
-	0x1bb000 | PTE_P | PTE_W,
-	0x1bc000 | PTE_P | PTE_W,
-	0x1bd000 | PTE_P | PTE_W,
-	0x1be000 | PTE_P | PTE_W,
-	0x1bf000 | PTE_P | PTE_W,
-	0x1c0000 | PTE_P | PTE_W,
-	0x1c1000 | PTE_P | PTE_W,
-	0x1c2000 | PTE_P | PTE_W,
-	0x1c3000 | PTE_P | PTE_W,
-	0x1c4000 | PTE_P | PTE_W,
-	0x1c5000 | PTE_P | PTE_W,
-	0x1c6000 | PTE_P | PTE_W,
-	0x1c7000 | PTE_P | PTE_W,
-	0x1c8000 | PTE_P | PTE_W,
-	0x1c9000 | PTE_P | PTE_W,
-	0x1ca000 | PTE_P | PTE_W,
-	0x1cb000 | PTE_P | PTE_W,
-	0x1cc000 | PTE_P | PTE_W,
-	0x1cd000 | PTE_P | PTE_W,
-	0x1ce000 | PTE_P | PTE_W,
-	0x1cf000 | PTE_P | PTE_W,
-	0x1d0000 | PTE_P | PTE_W,
-	0x1d1000 | PTE_P | PTE_W,
-	0x1d2000 | PTE_P | PTE_W,
-	0x1d3000 | PTE_P | PTE_W,
-	0x1d4000 | PTE_P | PTE_W,
-	0x1d5000 | PTE_P | PTE_W,
-	0x1d6000 | PTE_P | PTE_W,
-	0x1d7000 | PTE_P | PTE_W,
-	0x1d8000 | PTE_P | PTE_W,
-	0x1d9000 | PTE_P | PTE_W,
-	0x1da000 | PTE_P | PTE_W,
-	0x1db000 | PTE_P | PTE_W,
-	0x1dc000 | PTE_P | PTE_W,
-	0x1dd000 | PTE_P | PTE_W,
-	0x1de000 | PTE_P | PTE_W,
-	0x1df000 | PTE_P | PTE_W,
-	0x1e0000 | PTE_P | PTE_W,
-	0x1e1000 | PTE_P | PTE_W,
-	0x1e2000 | PTE_P | PTE_W,
-	0x1e3000 | PTE_P | PTE_W,
-	0x1e4000 | PTE_P | PTE_W,
-	0x1e5000 | PTE_P | PTE_W,
-	0x1e6000 | PTE_P | PTE_W,
-	0x1e7000 | PTE_P | PTE_W,
-	0x1e8000 | PTE_P | PTE_W,
-	0x1e9000 | PTE_P | PTE_W,
-	0x1ea000 | PTE_P | PTE_W,
-	0x1eb000 | PTE_P | PTE_W,
-	0x1ec000 | PTE_P | PTE_W,
-	0x1ed000 | PTE_P | PTE_W,
-	0x1ee000 | PTE_P | PTE_W,
-	0x1ef000 | PTE_P | PTE_W,
-	0x1f0000 | PTE_P | PTE_W,
-	0x1f1000 | PTE_P | PTE_W,
-	0x1f2000 | PTE_P | PTE_W,
-	0x1f3000 | PTE_P | PTE_W,
-	0x1f4000 | PTE_P | PTE_W,
-	0x1f5000 | PTE_P | PTE_W,
-	0x1f6000 | PTE_P | PTE_W,
-	0x1f7000 | PTE_P | PTE_W,
-	0x1f8000 | PTE_P | PTE_W,
-	0x1f9000 | PTE_P | PTE_W,
-	0x1fa000 | PTE_P | PTE_W,
-	0x1fb000 | PTE_P | PTE_W,
-	0x1fc000 | PTE_P | PTE_W,
-	0x1fd000 | PTE_P | PTE_W,
-	0x1fe000 | PTE_P | PTE_W,
-	0x1ff000 | PTE_P | PTE_W,
-	0x200000 | PTE_P | PTE_W,
-	0x201000 | PTE_P | PTE_W,
-	0x202000 | PTE_P | PTE_W,
-	0x203000 | PTE_P | PTE_W,
-	0x204000 | PTE_P | PTE_W,
-	0x205000 | PTE_P | PTE_W,
-	0x206000 | PTE_P | PTE_W,
-	0x207000 | PTE_P | PTE_W,
-	0x208000 | PTE_P | PTE_W,
-	0x209000 | PTE_P | PTE_W,
-	0x20a000 | PTE_P | PTE_W,
-	0x20b000 | PTE_P | PTE_W,
-	0x20c000 | PTE_P | PTE_W,
-	0x20d000 | PTE_P | PTE_W,
-	0x20e000 | PTE_P | PTE_W,
-	0x20f000 | PTE_P | PTE_W,
-	0x210000 | PTE_P | PTE_W,
-	0x211000 | PTE_P | PTE_W,
-	0x212000 | PTE_P | PTE_W,
-	0x213000 | PTE_P | PTE_W,
-	0x214000 | PTE_P | PTE_W,
-	0x215000 | PTE_P | PTE_W,
-	0x216000 | PTE_P | PTE_W,
-	0x217000 | PTE_P | PTE_W,
-	0x218000 | PTE_P | PTE_W,
-	0x219000 | PTE_P | PTE_W,
-	0x21a000 | PTE_P | PTE_W,
-	0x21b000 | PTE_P | PTE_W,
-	0x21c000 | PTE_P | PTE_W,
-	0x21d000 | PTE_P | PTE_W,
-	0x21e000 | PTE_P | PTE_W,
-	0x21f000 | PTE_P | PTE_W,
-	0x220000 | PTE_P | PTE_W,
-	0x221000 | PTE_P | PTE_W,
-	0x222000 | PTE_P | PTE_W,
-	0x223000 | PTE_P | PTE_W,
-	0x224000 | PTE_P | PTE_W,
-	0x225000 | PTE_P | PTE_W,
-	0x226000 | PTE_P | PTE_W,
-	0x227000 | PTE_P | PTE_W,
-	0x228000 | PTE_P | PTE_W,
-	0x229000 | PTE_P | PTE_W,
-	0x22a000 | PTE_P | PTE_W,
-	0x22b000 | PTE_P | PTE_W,
-	0x22c000 | PTE_P | PTE_W,
-	0x22d000 | PTE_P | PTE_W,
-	0x22e000 | PTE_P | PTE_W,
-	0x22f000 | PTE_P | PTE_W,
-	0x230000 | PTE_P | PTE_W,
-	0x231000 | PTE_P | PTE_W,
-	0x232000 | PTE_P | PTE_W,
-	0x233000 | PTE_P | PTE_W,
-	0x234000 | PTE_P | PTE_W,
-	0x235000 | PTE_P | PTE_W,
-	0x236000 | PTE_P | PTE_W,
-	0x237000 | PTE_P | PTE_W,
-	0x238000 | PTE_P | PTE_W,
-	0x239000 | PTE_P | PTE_W,
-	0x23a000 | PTE_P | PTE_W,
-	0x23b000 | PTE_P | PTE_W,
-	0x23c000 | PTE_P | PTE_W,
-	0x23d000 | PTE_P | PTE_W,
-	0x23e000 | PTE_P | PTE_W,
-	0x23f000 | PTE_P | PTE_W,
-	0x240000 | PTE_P | PTE_W,
-	0x241000 | PTE_P | PTE_W,
-	0x242000 | PTE_P | PTE_W,
-	0x243000 | PTE_P | PTE_W,
-	0x244000 | PTE_P | PTE_W,
-	0x245000 | PTE_P | PTE_W,
-	0x246000 | PTE_P | PTE_W,
-	0x247000 | PTE_P | PTE_W,
-	0x248000 | PTE_P | PTE_W,
-	0x249000 | PTE_P | PTE_W,
-	0x24a000 | PTE_P | PTE_W,
-	0x24b000 | PTE_P | PTE_W,
-	0x24c000 | PTE_P | PTE_W,
-	0x24d000 | PTE_P | PTE_W,
-	0x24e000 | PTE_P | PTE_W,
-	0x24f000 | PTE_P | PTE_W,
-	0x250000 | PTE_P | PTE_W,
-	0x251000 | PTE_P | PTE_W,
-	0x252000 | PTE_P | PTE_W,
-	0x253000 | PTE_P | PTE_W,
-	0x254000 | PTE_P | PTE_W,
-	0x255000 | PTE_P | PTE_W,
-	0x256000 | PTE_P | PTE_W,
-	0x257000 | PTE_P | PTE_W,
-	0x258000 | PTE_P | PTE_W,
-	0x259000 | PTE_P | PTE_W,
-	0x25a000 | PTE_P | PTE_W,
-	0x25b000 | PTE_P | PTE_W,
-	0x25c000 | PTE_P | PTE_W,
-	0x25d000 | PTE_P | PTE_W,
-	0x25e000 | PTE_P | PTE_W,
-	0x25f000 | PTE_P | PTE_W,
-	0x260000 | PTE_P | PTE_W,
-	0x261000 | PTE_P | PTE_W,
-	0x262000 | PTE_P | PTE_W,
-	0x263000 | PTE_P | PTE_W,
-	0x264000 | PTE_P | PTE_W,
-	0x265000 | PTE_P | PTE_W,
-	0x266000 | PTE_P | PTE_W,
-	0x267000 | PTE_P | PTE_W,
-	0x268000 | PTE_P | PTE_W,
-	0x269000 | PTE_P | PTE_W,
-	0x26a000 | PTE_P | PTE_W,
-	0x26b000 | PTE_P | PTE_W,
-	0x26c000 | PTE_P | PTE_W,
-	0x26d000 | PTE_P | PTE_W,
-	0x26e000 | PTE_P | PTE_W,
-	0x26f000 | PTE_P | PTE_W,
-	0x270000 | PTE_P | PTE_W,
-	0x271000 | PTE_P | PTE_W,
-	0x272000 | PTE_P | PTE_W,
-	0x273000 | PTE_P | PTE_W,
-	0x274000 | PTE_P | PTE_W,
-	0x275000 | PTE_P | PTE_W,
-	0x276000 | PTE_P | PTE_W,
-	0x277000 | PTE_P | PTE_W,
-	0x278000 | PTE_P | PTE_W,
-	0x279000 | PTE_P | PTE_W,
-	0x27a000 | PTE_P | PTE_W,
-	0x27b000 | PTE_P | PTE_W,
-	0x27c000 | PTE_P | PTE_W,
-	0x27d000 | PTE_P | PTE_W,
-	0x27e000 | PTE_P | PTE_W,
-	0x27f000 | PTE_P | PTE_W,
-	0x280000 | PTE_P | PTE_W,
-	0x281000 | PTE_P | PTE_W,
-	0x282000 | PTE_P | PTE_W,
-	0x283000 | PTE_P | PTE_W,
-	0x284000 | PTE_P | PTE_W,
-	0x285000 | PTE_P | PTE_W,
-	0x286000 | PTE_P | PTE_W,
-	0x287000 | PTE_P | PTE_W,
-	0x288000 | PTE_P | PTE_W,
-	0x289000 | PTE_P | PTE_W,
-	0x28a000 | PTE_P | PTE_W,
-	0x28b000 | PTE_P | PTE_W,
-	0x28c000 | PTE_P | PTE_W,
-	0x28d000 | PTE_P | PTE_W,
-	0x28e000 | PTE_P | PTE_W,
-	0x28f000 | PTE_P | PTE_W,
-	0x290000 | PTE_P | PTE_W,
-	0x291000 | PTE_P | PTE_W,
-	0x292000 | PTE_P | PTE_W,
-	0x293000 | PTE_P | PTE_W,
-	0x294000 | PTE_P | PTE_W,
-	0x295000 | PTE_P | PTE_W,
-	0x296000 | PTE_P | PTE_W,
-	0x297000 | PTE_P | PTE_W,
-	0x298000 | PTE_P | PTE_W,
-	0x299000 | PTE_P | PTE_W,
-	0x29a000 | PTE_P | PTE_W,
-	0x29b000 | PTE_P | PTE_W,
-	0x29c000 | PTE_P | PTE_W,
-	0x29d000 | PTE_P | PTE_W,
-	0x29e000 | PTE_P | PTE_W,
-	0x29f000 | PTE_P | PTE_W,
-	0x2a0000 | PTE_P | PTE_W,
-	0x2a1000 | PTE_P | PTE_W,
-	0x2a2000 | PTE_P | PTE_W,
-	0x2a3000 | PTE_P | PTE_W,
-	0x2a4000 | PTE_P | PTE_W,
-	0x2a5000 | PTE_P | PTE_W,
-	0x2a6000 | PTE_P | PTE_W,
-	0x2a7000 | PTE_P | PTE_W,
-	0x2a8000 | PTE_P | PTE_W,
-	0x2a9000 | PTE_P | PTE_W,
-	0x2aa000 | PTE_P | PTE_W,
-	0x2ab000 | PTE_P | PTE_W,
-	0x2ac000 | PTE_P | PTE_W,
-	0x2ad000 | PTE_P | PTE_W,
-	0x2ae000 | PTE_P | PTE_W,
-	0x2af000 | PTE_P | PTE_W,
-	0x2b0000 | PTE_P | PTE_W,
-	0x2b1000 | PTE_P | PTE_W,
-	0x2b2000 | PTE_P | PTE_W,
-	0x2b3000 | PTE_P | PTE_W,
-	0x2b4000 | PTE_P | PTE_W,
-	0x2b5000 | PTE_P | PTE_W,
-	0x2b6000 | PTE_P | PTE_W,
-	0x2b7000 | PTE_P | PTE_W,
-	0x2b8000 | PTE_P | PTE_W,
-	0x2b9000 | PTE_P | PTE_W,
-	0x2ba000 | PTE_P | PTE_W,
-	0x2bb000 | PTE_P | PTE_W,
-	0x2bc000 | PTE_P | PTE_W,
-	0x2bd000 | PTE_P | PTE_W,
-	0x2be000 | PTE_P | PTE_W,
-	0x2bf000 | PTE_P | PTE_W,
-	0x2c0000 | PTE_P | PTE_W,
-	0x2c1000 | PTE_P | PTE_W,
-	0x2c2000 | PTE_P | PTE_W,
-	0x2c3000 | PTE_P | PTE_W,
-	0x2c4000 | PTE_P | PTE_W,
-	0x2c5000 | PTE_P | PTE_W,
-	0x2c6000 | PTE_P | PTE_W,
-	0x2c7000 | PTE_P | PTE_W,
-	0x2c8000 | PTE_P | PTE_W,
-	0x2c9000 | PTE_P | PTE_W,
-	0x2ca000 | PTE_P | PTE_W,
-	0x2cb000 | PTE_P | PTE_W,
-	0x2cc000 | PTE_P | PTE_W,
-	0x2cd000 | PTE_P | PTE_W,
-	0x2ce000 | PTE_P | PTE_W,
-	0x2cf000 | PTE_P | PTE_W,
-	0x2d0000 | PTE_P | PTE_W,
-	0x2d1000 | PTE_P | PTE_W,
-	0x2d2000 | PTE_P | PTE_W,
-	0x2d3000 | PTE_P | PTE_W,
-	0x2d4000 | PTE_P | PTE_W,
-	0x2d5000 | PTE_P | PTE_W,
-	0x2d6000 | PTE_P | PTE_W,
-	0x2d7000 | PTE_P | PTE_W,
-	0x2d8000 | PTE_P | PTE_W,
-	0x2d9000 | PTE_P | PTE_W,
-	0x2da000 | PTE_P | PTE_W,
-	0x2db000 | PTE_P | PTE_W,
-	0x2dc000 | PTE_P | PTE_W,
-	0x2dd000 | PTE_P | PTE_W,
-	0x2de000 | PTE_P | PTE_W,
-	0x2df000 | PTE_P | PTE_W,
-	0x2e0000 | PTE_P | PTE_W,
-	0x2e1000 | PTE_P | PTE_W,
-	0x2e2000 | PTE_P | PTE_W,
-	0x2e3000 | PTE_P | PTE_W,
-	0x2e4000 | PTE_P | PTE_W,
-	0x2e5000 | PTE_P | PTE_W,
-	0x2e6000 | PTE_P | PTE_W,
-	0x2e7000 | PTE_P | PTE_W,
-	0x2e8000 | PTE_P | PTE_W,
-	0x2e9000 | PTE_P | PTE_W,
-	0x2ea000 | PTE_P | PTE_W,
-	0x2eb000 | PTE_P | PTE_W,
-	0x2ec000 | PTE_P | PTE_W,
-	0x2ed000 | PTE_P | PTE_W,
-	0x2ee000 | PTE_P | PTE_W,
-	0x2ef000 | PTE_P | PTE_W,
-	0x2f0000 | PTE_P | PTE_W,
-	0x2f1000 | PTE_P | PTE_W,
-	0x2f2000 | PTE_P | PTE_W,
-	0x2f3000 | PTE_P | PTE_W,
-	0x2f4000 | PTE_P | PTE_W,
-	0x2f5000 | PTE_P | PTE_W,
-	0x2f6000 | PTE_P | PTE_W,
-	0x2f7000 | PTE_P | PTE_W,
-	0x2f8000 | PTE_P | PTE_W,
-	0x2f9000 | PTE_P | PTE_W,
-	0x2fa000 | PTE_P | PTE_W,
-	0x2fb000 | PTE_P | PTE_W,
-	0x2fc000 | PTE_P | PTE_W,
-	0x2fd000 | PTE_P | PTE_W,
-	0x2fe000 | PTE_P | PTE_W,
-	0x2ff000 | PTE_P | PTE_W,
-	0x300000 | PTE_P | PTE_W,
-	0x301000 | PTE_P | PTE_W,
-	0x302000 | PTE_P | PTE_W,
-	0x303000 | PTE_P | PTE_W,
-	0x304000 | PTE_P | PTE_W,
-	0x305000 | PTE_P | PTE_W,
-	0x306000 | PTE_P | PTE_W,
-	0x307000 | PTE_P | PTE_W,
-	0x308000 | PTE_P | PTE_W,
-	0x309000 | PTE_P | PTE_W,
-	0x30a000 | PTE_P | PTE_W,
-	0x30b000 | PTE_P | PTE_W,
-	0x30c000 | PTE_P | PTE_W,
-	0x30d000 | PTE_P | PTE_W,
-	0x30e000 | PTE_P | PTE_W,
-	0x30f000 | PTE_P | PTE_W,
-	0x310000 | PTE_P | PTE_W,
-	0x311000 | PTE_P | PTE_W,
-	0x312000 | PTE_P | PTE_W,
-	0x313000 | PTE_P | PTE_W,
-	0x314000 | PTE_P | PTE_W,
-	0x315000 | PTE_P | PTE_W,
-	0x316000 | PTE_P | PTE_W,
-	0x317000 | PTE_P | PTE_W,
-	0x318000 | PTE_P | PTE_W,
-	0x319000 | PTE_P | PTE_W,
-	0x31a000 | PTE_P | PTE_W,
-	0x31b000 | PTE_P | PTE_W,
-	0x31c000 | PTE_P | PTE_W,
-	0x31d000 | PTE_P | PTE_W,
-	0x31e000 | PTE_P | PTE_W,
-	0x31f000 | PTE_P | PTE_W,
-	0x320000 | PTE_P | PTE_W,
-	0x321000 | PTE_P | PTE_W,
-	0x322000 | PTE_P | PTE_W,
-	0x323000 | PTE_P | PTE_W,
-	0x324000 | PTE_P | PTE_W,
-	0x325000 | PTE_P | PTE_W,
-	0x326000 | PTE_P | PTE_W,
-	0x327000 | PTE_P | PTE_W,
-	0x328000 | PTE_P | PTE_W,
-	0x329000 | PTE_P | PTE_W,
-	0x32a000 | PTE_P | PTE_W,
-	0x32b000 | PTE_P | PTE_W,
-	0x32c000 | PTE_P | PTE_W,
-	0x32d000 | PTE_P | PTE_W,
-	0x32e000 | PTE_P | PTE_W,
-	0x32f000 | PTE_P | PTE_W,
-	0x330000 | PTE_P | PTE_W,
-	0x331000 | PTE_P | PTE_W,
-	0x332000 | PTE_P | PTE_W,
-	0x333000 | PTE_P | PTE_W,
-	0x334000 | PTE_P | PTE_W,
-	0x335000 | PTE_P | PTE_W,
-	0x336000 | PTE_P | PTE_W,
-	0x337000 | PTE_P | PTE_W,
-	0x338000 | PTE_P | PTE_W,
-	0x339000 | PTE_P | PTE_W,
-	0x33a000 | PTE_P | PTE_W,
-	0x33b000 | PTE_P | PTE_W,
-	0x33c000 | PTE_P | PTE_W,
-	0x33d000 | PTE_P | PTE_W,
-	0x33e000 | PTE_P | PTE_W,
-	0x33f000 | PTE_P | PTE_W,
-	0x340000 | PTE_P | PTE_W,
-	0x341000 | PTE_P | PTE_W,
-	0x342000 | PTE_P | PTE_W,
-	0x343000 | PTE_P | PTE_W,
-	0x344000 | PTE_P | PTE_W,
-	0x345000 | PTE_P | PTE_W,
-	0x346000 | PTE_P | PTE_W,
-	0x347000 | PTE_P | PTE_W,
-	0x348000 | PTE_P | PTE_W,
-	0x349000 | PTE_P | PTE_W,
-	0x34a000 | PTE_P | PTE_W,
-	0x34b000 | PTE_P | PTE_W,
-	0x34c000 | PTE_P | PTE_W,
-	0x34d000 | PTE_P | PTE_W,
-	0x34e000 | PTE_P | PTE_W,
-	0x34f000 | PTE_P | PTE_W,
-	0x350000 | PTE_P | PTE_W,
-	0x351000 | PTE_P | PTE_W,
-	0x352000 | PTE_P | PTE_W,
-	0x353000 | PTE_P | PTE_W,
-	0x354000 | PTE_P | PTE_W,
-	0x355000 | PTE_P | PTE_W,
-	0x356000 | PTE_P | PTE_W,
-	0x357000 | PTE_P | PTE_W,
-	0x358000 | PTE_P | PTE_W,
-	0x359000 | PTE_P | PTE_W,
-	0x35a000 | PTE_P | PTE_W,
-	0x35b000 | PTE_P | PTE_W,
-	0x35c000 | PTE_P | PTE_W,
-	0x35d000 | PTE_P | PTE_W,
-	0x35e000 | PTE_P | PTE_W,
-	0x35f000 | PTE_P | PTE_W,
-	0x360000 | PTE_P | PTE_W,
-	0x361000 | PTE_P | PTE_W,
-	0x362000 | PTE_P | PTE_W,
-	0x363000 | PTE_P | PTE_W,
-	0x364000 | PTE_P | PTE_W,
-	0x365000 | PTE_P | PTE_W,
-	0x366000 | PTE_P | PTE_W,
-	0x367000 | PTE_P | PTE_W,
-	0x368000 | PTE_P | PTE_W,
-	0x369000 | PTE_P | PTE_W,
-	0x36a000 | PTE_P | PTE_W,
-	0x36b000 | PTE_P | PTE_W,
-	0x36c000 | PTE_P | PTE_W,
-	0x36d000 | PTE_P | PTE_W,
-	0x36e000 | PTE_P | PTE_W,
-	0x36f000 | PTE_P | PTE_W,
-	0x370000 | PTE_P | PTE_W,
-	0x371000 | PTE_P | PTE_W,
-	0x372000 | PTE_P | PTE_W,
-	0x373000 | PTE_P | PTE_W,
-	0x374000 | PTE_P | PTE_W,
-	0x375000 | PTE_P | PTE_W,
-	0x376000 | PTE_P | PTE_W,
-	0x377000 | PTE_P | PTE_W,
-	0x378000 | PTE_P | PTE_W,
-	0x379000 | PTE_P | PTE_W,
-	0x37a000 | PTE_P | PTE_W,
-	0x37b000 | PTE_P | PTE_W,
-	0x37c000 | PTE_P | PTE_W,
-	0x37d000 | PTE_P | PTE_W,
-	0x37e000 | PTE_P | PTE_W,
-	0x37f000 | PTE_P | PTE_W,
-	0x380000 | PTE_P | PTE_W,
-	0x381000 | PTE_P | PTE_W,
-	0x382000 | PTE_P | PTE_W,
-	0x383000 | PTE_P | PTE_W,
-	0x384000 | PTE_P | PTE_W,
-	0x385000 | PTE_P | PTE_W,
-	0x386000 | PTE_P | PTE_W,
-	0x387000 | PTE_P | PTE_W,
-	0x388000 | PTE_P | PTE_W,
-	0x389000 | PTE_P | PTE_W,
-	0x38a000 | PTE_P | PTE_W,
-	0x38b000 | PTE_P | PTE_W,
-	0x38c000 | PTE_P | PTE_W,
-	0x38d000 | PTE_P | PTE_W,
-	0x38e000 | PTE_P | PTE_W,
-	0x38f000 | PTE_P | PTE_W,
-	0x390000 | PTE_P | PTE_W,
-	0x391000 | PTE_P | PTE_W,
-	0x392000 | PTE_P | PTE_W,
-	0x393000 | PTE_P | PTE_W,
-	0x394000 | PTE_P | PTE_W,
-	0x395000 | PTE_P | PTE_W,
-	0x396000 | PTE_P | PTE_W,
-	0x397000 | PTE_P | PTE_W,
-	0x398000 | PTE_P | PTE_W,
-	0x399000 | PTE_P | PTE_W,
-	0x39a000 | PTE_P | PTE_W,
-	0x39b000 | PTE_P | PTE_W,
-	0x39c000 | PTE_P | PTE_W,
-	0x39d000 | PTE_P | PTE_W,
-	0x39e000 | PTE_P | PTE_W,
-	0x39f000 | PTE_P | PTE_W,
-	0x3a0000 | PTE_P | PTE_W,
-	0x3a1000 | PTE_P | PTE_W,
-	0x3a2000 | PTE_P | PTE_W,
-	0x3a3000 | PTE_P | PTE_W,
-	0x3a4000 | PTE_P | PTE_W,
-	0x3a5000 | PTE_P | PTE_W,
-	0x3a6000 | PTE_P | PTE_W,
-	0x3a7000 | PTE_P | PTE_W,
-	0x3a8000 | PTE_P | PTE_W,
-	0x3a9000 | PTE_P | PTE_W,
-	0x3aa000 | PTE_P | PTE_W,
-	0x3ab000 | PTE_P | PTE_W,
-	0x3ac000 | PTE_P | PTE_W,
-	0x3ad000 | PTE_P | PTE_W,
-	0x3ae000 | PTE_P | PTE_W,
-	0x3af000 | PTE_P | PTE_W,
-	0x3b0000 | PTE_P | PTE_W,
-	0x3b1000 | PTE_P | PTE_W,
-	0x3b2000 | PTE_P | PTE_W,
-	0x3b3000 | PTE_P | PTE_W,
-	0x3b4000 | PTE_P | PTE_W,
-	0x3b5000 | PTE_P | PTE_W,
-	0x3b6000 | PTE_P | PTE_W,
-	0x3b7000 | PTE_P | PTE_W,
-	0x3b8000 | PTE_P | PTE_W,
-	0x3b9000 | PTE_P | PTE_W,
-	0x3ba000 | PTE_P | PTE_W,
-	0x3bb000 | PTE_P | PTE_W,
-	0x3bc000 | PTE_P | PTE_W,
-	0x3bd000 | PTE_P | PTE_W,
-	0x3be000 | PTE_P | PTE_W,
-	0x3bf000 | PTE_P | PTE_W,
-	0x3c0000 | PTE_P | PTE_W,
-	0x3c1000 | PTE_P | PTE_W,
-	0x3c2000 | PTE_P | PTE_W,
-	0x3c3000 | PTE_P | PTE_W,
-	0x3c4000 | PTE_P | PTE_W,
-	0x3c5000 | PTE_P | PTE_W,
-	0x3c6000 | PTE_P | PTE_W,
-	0x3c7000 | PTE_P | PTE_W,
-	0x3c8000 | PTE_P | PTE_W,
-	0x3c9000 | PTE_P | PTE_W,
-	0x3ca000 | PTE_P | PTE_W,
-	0x3cb000 | PTE_P | PTE_W,
-	0x3cc000 | PTE_P | PTE_W,
-	0x3cd000 | PTE_P | PTE_W,
-	0x3ce000 | PTE_P | PTE_W,
-	0x3cf000 | PTE_P | PTE_W,
-	0x3d0000 | PTE_P | PTE_W,
-	0x3d1000 | PTE_P | PTE_W,
-	0x3d2000 | PTE_P | PTE_W,
-	0x3d3000 | PTE_P | PTE_W,
-	0x3d4000 | PTE_P | PTE_W,
-	0x3d5000 | PTE_P | PTE_W,
-	0x3d6000 | PTE_P | PTE_W,
-	0x3d7000 | PTE_P | PTE_W,
-	0x3d8000 | PTE_P | PTE_W,
-	0x3d9000 | PTE_P | PTE_W,
-	0x3da000 | PTE_P | PTE_W,
-	0x3db000 | PTE_P | PTE_W,
-	0x3dc000 | PTE_P | PTE_W,
-	0x3dd000 | PTE_P | PTE_W,
-	0x3de000 | PTE_P | PTE_W,
-	0x3df000 | PTE_P | PTE_W,
-	0x3e0000 | PTE_P | PTE_W,
-	0x3e1000 | PTE_P | PTE_W,
-	0x3e2000 | PTE_P | PTE_W,
-	0x3e3000 | PTE_P | PTE_W,
-	0x3e4000 | PTE_P | PTE_W,
-	0x3e5000 | PTE_P | PTE_W,
-	0x3e6000 | PTE_P | PTE_W,
-	0x3e7000 | PTE_P | PTE_W,
-	0x3e8000 | PTE_P | PTE_W,
-	0x3e9000 | PTE_P | PTE_W,
-	0x3ea000 | PTE_P | PTE_W,
-	0x3eb000 | PTE_P | PTE_W,
-	0x3ec000 | PTE_P | PTE_W,
-	0x3ed000 | PTE_P | PTE_W,
-	0x3ee000 | PTE_P | PTE_W,
-	0x3ef000 | PTE_P | PTE_W,
-	0x3f0000 | PTE_P | PTE_W,
-	0x3f1000 | PTE_P | PTE_W,
-	0x3f2000 | PTE_P | PTE_W,
-	0x3f3000 | PTE_P | PTE_W,
-	0x3f4000 | PTE_P | PTE_W,
-	0x3f5000 | PTE_P | PTE_W,
-	0x3f6000 | PTE_P | PTE_W,
-	0x3f7000 | PTE_P | PTE_W,
-	0x3f8000 | PTE_P | PTE_W,
-	0x3f9000 | PTE_P | PTE_W,
-	0x3fa000 | PTE_P | PTE_W,
-	0x3fb000 | PTE_P | PTE_W,
-	0x3fc000 | PTE_P | PTE_W,
-	0x3fd000 | PTE_P | PTE_W,
-	0x3fe000 | PTE_P | PTE_W,
-	0x3ff000 | PTE_P | PTE_W,
-};
-
-__attribute__((__aligned__(PGSIZE)))
-pte_t entry_pgtable1[NPTENTRIES] = {
-	0x400000 | PTE_P | PTE_W,
-	0x401000 | PTE_P | PTE_W,
-	0x402000 | PTE_P | PTE_W,
-	0x403000 | PTE_P | PTE_W,
-	0x404000 | PTE_P | PTE_W,
-	0x405000 | PTE_P | PTE_W,
-	0x406000 | PTE_P | PTE_W,
-	0x407000 | PTE_P | PTE_W,
-	0x408000 | PTE_P | PTE_W,
-	0x409000 | PTE_P | PTE_W,
-	0x40a000 | PTE_P | PTE_W,
-	0x40b000 | PTE_P | PTE_W,
-	0x40c000 | PTE_P | PTE_W,
-	0x40d000 | PTE_P | PTE_W,
-	0x40e000 | PTE_P | PTE_W,
-	0x40f000 | PTE_P | PTE_W,
-	0x410000 | PTE_P | PTE_W,
-	0x411000 | PTE_P | PTE_W,
-	0x412000 | PTE_P | PTE_W,
-	0x413000 | PTE_P | PTE_W,
-	0x414000 | PTE_P | PTE_W,
-	0x415000 | PTE_P | PTE_W,
-	0x416000 | PTE_P | PTE_W,
-	0x417000 | PTE_P | PTE_W,
-	0x418000 | PTE_P | PTE_W,
-	0x419000 | PTE_P | PTE_W,
-	0x41a000 | PTE_P | PTE_W,
-	0x41b000 | PTE_P | PTE_W,
-	0x41c000 | PTE_P | PTE_W,
-	0x41d000 | PTE_P | PTE_W,
-	0x41e000 | PTE_P | PTE_W,
-	0x41f000 | PTE_P | PTE_W,
-	0x420000 | PTE_P | PTE_W,
-	0x421000 | PTE_P | PTE_W,
-	0x422000 | PTE_P | PTE_W,
-	0x423000 | PTE_P | PTE_W,
-	0x424000 | PTE_P | PTE_W,
-	0x425000 | PTE_P | PTE_W,
-	0x426000 | PTE_P | PTE_W,
-	0x427000 | PTE_P | PTE_W,
-	0x428000 | PTE_P | PTE_W,
-	0x429000 | PTE_P | PTE_W,
-	0x42a000 | PTE_P | PTE_W,
-	0x42b000 | PTE_P | PTE_W,
-	0x42c000 | PTE_P | PTE_W,
-	0x42d000 | PTE_P | PTE_W,
-	0x42e000 | PTE_P | PTE_W,
-	0x42f000 | PTE_P | PTE_W,
-	0x430000 | PTE_P | PTE_W,
-	0x431000 | PTE_P | PTE_W,
-	0x432000 | PTE_P | PTE_W,
-	0x433000 | PTE_P | PTE_W,
-	0x434000 | PTE_P | PTE_W,
-	0x435000 | PTE_P | PTE_W,
-	0x436000 | PTE_P | PTE_W,
-	0x437000 | PTE_P | PTE_W,
-	0x438000 | PTE_P | PTE_W,
-	0x439000 | PTE_P | PTE_W,
-	0x43a000 | PTE_P | PTE_W,
-	0x43b000 | PTE_P | PTE_W,
-	0x43c000 | PTE_P | PTE_W,
-	0x43d000 | PTE_P | PTE_W,
-	0x43e000 | PTE_P | PTE_W,
-	0x43f000 | PTE_P | PTE_W,
-	0x440000 | PTE_P | PTE_W,
-	0x441000 | PTE_P | PTE_W,
-	0x442000 | PTE_P | PTE_W,
-	0x443000 | PTE_P | PTE_W,
-	0x444000 | PTE_P | PTE_W,
-	0x445000 | PTE_P | PTE_W,
-	0x446000 | PTE_P | PTE_W,
-	0x447000 | PTE_P | PTE_W,
-	0x448000 | PTE_P | PTE_W,
-	0x449000 | PTE_P | PTE_W,
-	0x44a000 | PTE_P | PTE_W,
-	0x44b000 | PTE_P | PTE_W,
-	0x44c000 | PTE_P | PTE_W,
-	0x44d000 | PTE_P | PTE_W,
-	0x44e000 | PTE_P | PTE_W,
-	0x44f000 | PTE_P | PTE_W,
-	0x450000 | PTE_P | PTE_W,
-	0x451000 | PTE_P | PTE_W,
-	0x452000 | PTE_P | PTE_W,
-	0x453000 | PTE_P | PTE_W,
-	0x454000 | PTE_P | PTE_W,
-	0x455000 | PTE_P | PTE_W,
-	0x456000 | PTE_P | PTE_W,
-	0x457000 | PTE_P | PTE_W,
-	0x458000 | PTE_P | PTE_W,
-	0x459000 | PTE_P | PTE_W,
-	0x45a000 | PTE_P | PTE_W,
-	0x45b000 | PTE_P | PTE_W,
-	0x45c000 | PTE_P | PTE_W,
-	0x45d000 | PTE_P | PTE_W,
-	0x45e000 | PTE_P | PTE_W,
-	0x45f000 | PTE_P | PTE_W,
-	0x460000 | PTE_P | PTE_W,
-	0x461000 | PTE_P | PTE_W,
-	0x462000 | PTE_P | PTE_W,
-	0x463000 | PTE_P | PTE_W,
-	0x464000 | PTE_P | PTE_W,
-	0x465000 | PTE_P | PTE_W,
-	0x466000 | PTE_P | PTE_W,
-	0x467000 | PTE_P | PTE_W,
-	0x468000 | PTE_P | PTE_W,
-	0x469000 | PTE_P | PTE_W,
-	0x46a000 | PTE_P | PTE_W,
-	0x46b000 | PTE_P | PTE_W,
-	0x46c000 | PTE_P | PTE_W,
-	0x46d000 | PTE_P | PTE_W,
-	0x46e000 | PTE_P | PTE_W,
-	0x46f000 | PTE_P | PTE_W,
-	0x470000 | PTE_P | PTE_W,
-	0x471000 | PTE_P | PTE_W,
-	0x472000 | PTE_P | PTE_W,
-	0x473000 | PTE_P | PTE_W,
-	0x474000 | PTE_P | PTE_W,
-	0x475000 | PTE_P | PTE_W,
-	0x476000 | PTE_P | PTE_W,
-	0x477000 | PTE_P | PTE_W,
-	0x478000 | PTE_P | PTE_W,
-	0x479000 | PTE_P | PTE_W,
-	0x47a000 | PTE_P | PTE_W,
-	0x47b000 | PTE_P | PTE_W,
-	0x47c000 | PTE_P | PTE_W,
-	0x47d000 | PTE_P | PTE_W,
-	0x47e000 | PTE_P | PTE_W,
-	0x47f000 | PTE_P | PTE_W,
-	0x480000 | PTE_P | PTE_W,
-	0x481000 | PTE_P | PTE_W,
-	0x482000 | PTE_P | PTE_W,
-	0x483000 | PTE_P | PTE_W,
-	0x484000 | PTE_P | PTE_W,
-	0x485000 | PTE_P | PTE_W,
-	0x486000 | PTE_P | PTE_W,
-	0x487000 | PTE_P | PTE_W,
-	0x488000 | PTE_P | PTE_W,
-	0x489000 | PTE_P | PTE_W,
-	0x48a000 | PTE_P | PTE_W,
-	0x48b000 | PTE_P | PTE_W,
-	0x48c000 | PTE_P | PTE_W,
-	0x48d000 | PTE_P | PTE_W,
-	0x48e000 | PTE_P | PTE_W,
-	0x48f000 | PTE_P | PTE_W,
-	0x490000 | PTE_P | PTE_W,
-	0x491000 | PTE_P | PTE_W,
-	0x492000 | PTE_P | PTE_W,
-	0x493000 | PTE_P | PTE_W,
-	0x494000 | PTE_P | PTE_W,
-	0x495000 | PTE_P | PTE_W,
-	0x496000 | PTE_P | PTE_W,
-	0x497000 | PTE_P | PTE_W,
-	0x498000 | PTE_P | PTE_W,
-	0x499000 | PTE_P | PTE_W,
-	0x49a000 | PTE_P | PTE_W,
-	0x49b000 | PTE_P | PTE_W,
-	0x49c000 | PTE_P | PTE_W,
-	0x49d000 | PTE_P | PTE_W,
-	0x49e000 | PTE_P | PTE_W,
-	0x49f000 | PTE_P | PTE_W,
-	0x4a0000 | PTE_P | PTE_W,
-	0x4a1000 | PTE_P | PTE_W,
-	0x4a2000 | PTE_P | PTE_W,
-	0x4a3000 | PTE_P | PTE_W,
-	0x4a4000 | PTE_P | PTE_W,
-	0x4a5000 | PTE_P | PTE_W,
-	0x4a6000 | PTE_P | PTE_W,
-	0x4a7000 | PTE_P | PTE_W,
-	0x4a8000 | PTE_P | PTE_W,
-	0x4a9000 | PTE_P | PTE_W,
-	0x4aa000 | PTE_P | PTE_W,
-	0x4ab000 | PTE_P | PTE_W,
-	0x4ac000 | PTE_P | PTE_W,
-	0x4ad000 | PTE_P | PTE_W,
-	0x4ae000 | PTE_P | PTE_W,
-	0x4af000 | PTE_P | PTE_W,
-	0x4b0000 | PTE_P | PTE_W,
-	0x4b1000 | PTE_P | PTE_W,
-	0x4b2000 | PTE_P | PTE_W,
-	0x4b3000 | PTE_P | PTE_W,
-	0x4b4000 | PTE_P | PTE_W,
-	0x4b5000 | PTE_P | PTE_W,
-	0x4b6000 | PTE_P | PTE_W,
-	0x4b7000 | PTE_P | PTE_W,
-	0x4b8000 | PTE_P | PTE_W,
-	0x4b9000 | PTE_P | PTE_W,
-	0x4ba000 | PTE_P | PTE_W,
-	0x4bb000 | PTE_P | PTE_W,
-	0x4bc000 | PTE_P | PTE_W,
-	0x4bd000 | PTE_P | PTE_W,
-	0x4be000 | PTE_P | PTE_W,
-	0x4bf000 | PTE_P | PTE_W,
-	0x4c0000 | PTE_P | PTE_W,
-	0x4c1000 | PTE_P | PTE_W,
-	0x4c2000 | PTE_P | PTE_W,
-	0x4c3000 | PTE_P | PTE_W,
-	0x4c4000 | PTE_P | PTE_W,
-	0x4c5000 | PTE_P | PTE_W,
-	0x4c6000 | PTE_P | PTE_W,
-	0x4c7000 | PTE_P | PTE_W,
-	0x4c8000 | PTE_P | PTE_W,
-	0x4c9000 | PTE_P | PTE_W,
-	0x4ca000 | PTE_P | PTE_W,
-	0x4cb000 | PTE_P | PTE_W,
-	0x4cc000 | PTE_P | PTE_W,
-	0x4cd000 | PTE_P | PTE_W,
-	0x4ce000 | PTE_P | PTE_W,
-	0x4cf000 | PTE_P | PTE_W,
-	0x4d0000 | PTE_P | PTE_W,
-	0x4d1000 | PTE_P | PTE_W,
-	0x4d2000 | PTE_P | PTE_W,
-	0x4d3000 | PTE_P | PTE_W,
-	0x4d4000 | PTE_P | PTE_W,
-	0x4d5000 | PTE_P | PTE_W,
-	0x4d6000 | PTE_P | PTE_W,
-	0x4d7000 | PTE_P | PTE_W,
-	0x4d8000 | PTE_P | PTE_W,
-	0x4d9000 | PTE_P | PTE_W,
-	0x4da000 | PTE_P | PTE_W,
-	0x4db000 | PTE_P | PTE_W,
-	0x4dc000 | PTE_P | PTE_W,
-	0x4dd000 | PTE_P | PTE_W,
-	0x4de000 | PTE_P | PTE_W,
-	0x4df000 | PTE_P | PTE_W,
-	0x4e0000 | PTE_P | PTE_W,
-	0x4e1000 | PTE_P | PTE_W,
-	0x4e2000 | PTE_P | PTE_W,
-	0x4e3000 | PTE_P | PTE_W,
-	0x4e4000 | PTE_P | PTE_W,
-	0x4e5000 | PTE_P | PTE_W,
-	0x4e6000 | PTE_P | PTE_W,
-	0x4e7000 | PTE_P | PTE_W,
-	0x4e8000 | PTE_P | PTE_W,
-	0x4e9000 | PTE_P | PTE_W,
-	0x4ea000 | PTE_P | PTE_W,
-	0x4eb000 | PTE_P | PTE_W,
-	0x4ec000 | PTE_P | PTE_W,
-	0x4ed000 | PTE_P | PTE_W,
-	0x4ee000 | PTE_P | PTE_W,
-	0x4ef000 | PTE_P | PTE_W,
-	0x4f0000 | PTE_P | PTE_W,
-	0x4f1000 | PTE_P | PTE_W,
-	0x4f2000 | PTE_P | PTE_W,
-	0x4f3000 | PTE_P | PTE_W,
-	0x4f4000 | PTE_P | PTE_W,
-	0x4f5000 | PTE_P | PTE_W,
-	0x4f6000 | PTE_P | PTE_W,
-	0x4f7000 | PTE_P | PTE_W,
-	0x4f8000 | PTE_P | PTE_W,
-	0x4f9000 | PTE_P | PTE_W,
-	0x4fa000 | PTE_P | PTE_W,
-	0x4fb000 | PTE_P | PTE_W,
-	0x4fc000 | PTE_P | PTE_W,
-	0x4fd000 | PTE_P | PTE_W,
-	0x4fe000 | PTE_P | PTE_W,
-	0x4ff000 | PTE_P | PTE_W,
-	0x500000 | PTE_P | PTE_W,
-	0x501000 | PTE_P | PTE_W,
-	0x502000 | PTE_P | PTE_W,
-	0x503000 | PTE_P | PTE_W,
-	0x504000 | PTE_P | PTE_W,
-	0x505000 | PTE_P | PTE_W,
-	0x506000 | PTE_P | PTE_W,
-	0x507000 | PTE_P | PTE_W,
-	0x508000 | PTE_P | PTE_W,
-	0x509000 | PTE_P | PTE_W,
-	0x50a000 | PTE_P | PTE_W,
-	0x50b000 | PTE_P | PTE_W,
-	0x50c000 | PTE_P | PTE_W,
-	0x50d000 | PTE_P | PTE_W,
-	0x50e000 | PTE_P | PTE_W,
-	0x50f000 | PTE_P | PTE_W,
-	0x510000 | PTE_P | PTE_W,
-	0x511000 | PTE_P | PTE_W,
-	0x512000 | PTE_P | PTE_W,
-	0x513000 | PTE_P | PTE_W,
-	0x514000 | PTE_P | PTE_W,
-	0x515000 | PTE_P | PTE_W,
-	0x516000 | PTE_P | PTE_W,
-	0x517000 | PTE_P | PTE_W,
-	0x518000 | PTE_P | PTE_W,
-	0x519000 | PTE_P | PTE_W,
-	0x51a000 | PTE_P | PTE_W,
-	0x51b000 | PTE_P | PTE_W,
-	0x51c000 | PTE_P | PTE_W,
-	0x51d000 | PTE_P | PTE_W,
-	0x51e000 | PTE_P | PTE_W,
-	0x51f000 | PTE_P | PTE_W,
-	0x520000 | PTE_P | PTE_W,
-	0x521000 | PTE_P | PTE_W,
-	0x522000 | PTE_P | PTE_W,
-	0x523000 | PTE_P | PTE_W,
-	0x524000 | PTE_P | PTE_W,
-	0x525000 | PTE_P | PTE_W,
-	0x526000 | PTE_P | PTE_W,
-	0x527000 | PTE_P | PTE_W,
-	0x528000 | PTE_P | PTE_W,
-	0x529000 | PTE_P | PTE_W,
-	0x52a000 | PTE_P | PTE_W,
-	0x52b000 | PTE_P | PTE_W,
-	0x52c000 | PTE_P | PTE_W,
-	0x52d000 | PTE_P | PTE_W,
-	0x52e000 | PTE_P | PTE_W,
-	0x52f000 | PTE_P | PTE_W,
-	0x530000 | PTE_P | PTE_W,
-	0x531000 | PTE_P | PTE_W,
-	0x532000 | PTE_P | PTE_W,
-	0x533000 | PTE_P | PTE_W,
-	0x534000 | PTE_P | PTE_W,
-	0x535000 | PTE_P | PTE_W,
-	0x536000 | PTE_P | PTE_W,
-	0x537000 | PTE_P | PTE_W,
-	0x538000 | PTE_P | PTE_W,
-	0x539000 | PTE_P | PTE_W,
-	0x53a000 | PTE_P | PTE_W,
-	0x53b000 | PTE_P | PTE_W,
-	0x53c000 | PTE_P | PTE_W,
-	0x53d000 | PTE_P | PTE_W,
-	0x53e000 | PTE_P | PTE_W,
-	0x53f000 | PTE_P | PTE_W,
-	0x540000 | PTE_P | PTE_W,
-	0x541000 | PTE_P | PTE_W,
-	0x542000 | PTE_P | PTE_W,
-	0x543000 | PTE_P | PTE_W,
-	0x544000 | PTE_P | PTE_W,
-	0x545000 | PTE_P | PTE_W,
-	0x546000 | PTE_P | PTE_W,
-	0x547000 | PTE_P | PTE_W,
-	0x548000 | PTE_P | PTE_W,
-	0x549000 | PTE_P | PTE_W,
-	0x54a000 | PTE_P | PTE_W,
-	0x54b000 | PTE_P | PTE_W,
-	0x54c000 | PTE_P | PTE_W,
-	0x54d000 | PTE_P | PTE_W,
-	0x54e000 | PTE_P | PTE_W,
-	0x54f000 | PTE_P | PTE_W,
-	0x550000 | PTE_P | PTE_W,
-	0x551000 | PTE_P | PTE_W,
-	0x552000 | PTE_P | PTE_W,
-	0x553000 | PTE_P | PTE_W,
-	0x554000 | PTE_P | PTE_W,
-	0x555000 | PTE_P | PTE_W,
-	0x556000 | PTE_P | PTE_W,
-	0x557000 | PTE_P | PTE_W,
-	0x558000 | PTE_P | PTE_W,
-	0x559000 | PTE_P | PTE_W,
-	0x55a000 | PTE_P | PTE_W,
-	0x55b000 | PTE_P | PTE_W,
-	0x55c000 | PTE_P | PTE_W,
-	0x55d000 | PTE_P | PTE_W,
-	0x55e000 | PTE_P | PTE_W,
-	0x55f000 | PTE_P | PTE_W,
-	0x560000 | PTE_P | PTE_W,
-	0x561000 | PTE_P | PTE_W,
-	0x562000 | PTE_P | PTE_W,
-	0x563000 | PTE_P | PTE_W,
-	0x564000 | PTE_P | PTE_W,
-	0x565000 | PTE_P | PTE_W,
-	0x566000 | PTE_P | PTE_W,
-	0x567000 | PTE_P | PTE_W,
-	0x568000 | PTE_P | PTE_W,
-	0x569000 | PTE_P | PTE_W,
-	0x56a000 | PTE_P | PTE_W,
-	0x56b000 | PTE_P | PTE_W,
-	0x56c000 | PTE_P | PTE_W,
-	0x56d000 | PTE_P | PTE_W,
-	0x56e000 | PTE_P | PTE_W,
-	0x56f000 | PTE_P | PTE_W,
-	0x570000 | PTE_P | PTE_W,
-	0x571000 | PTE_P | PTE_W,
-	0x572000 | PTE_P | PTE_W,
-	0x573000 | PTE_P | PTE_W,
-	0x574000 | PTE_P | PTE_W,
-	0x575000 | PTE_P | PTE_W,
-	0x576000 | PTE_P | PTE_W,
-	0x577000 | PTE_P | PTE_W,
-	0x578000 | PTE_P | PTE_W,
-	0x579000 | PTE_P | PTE_W,
-	0x57a000 | PTE_P | PTE_W,
-	0x57b000 | PTE_P | PTE_W,
-	0x57c000 | PTE_P | PTE_W,
-	0x57d000 | PTE_P | PTE_W,
-	0x57e000 | PTE_P | PTE_W,
-	0x57f000 | PTE_P | PTE_W,
-	0x580000 | PTE_P | PTE_W,
-	0x581000 | PTE_P | PTE_W,
-	0x582000 | PTE_P | PTE_W,
-	0x583000 | PTE_P | PTE_W,
-	0x584000 | PTE_P | PTE_W,
-	0x585000 | PTE_P | PTE_W,
-	0x586000 | PTE_P | PTE_W,
-	0x587000 | PTE_P | PTE_W,
-	0x588000 | PTE_P | PTE_W,
-	0x589000 | PTE_P | PTE_W,
-	0x58a000 | PTE_P | PTE_W,
-	0x58b000 | PTE_P | PTE_W,
-	0x58c000 | PTE_P | PTE_W,
-	0x58d000 | PTE_P | PTE_W,
-	0x58e000 | PTE_P | PTE_W,
-	0x58f000 | PTE_P | PTE_W,
-	0x590000 | PTE_P | PTE_W,
-	0x591000 | PTE_P | PTE_W,
-	0x592000 | PTE_P | PTE_W,
-	0x593000 | PTE_P | PTE_W,
-	0x594000 | PTE_P | PTE_W,
-	0x595000 | PTE_P | PTE_W,
-	0x596000 | PTE_P | PTE_W,
-	0x597000 | PTE_P | PTE_W,
-	0x598000 | PTE_P | PTE_W,
-	0x599000 | PTE_P | PTE_W,
-	0x59a000 | PTE_P | PTE_W,
-	0x59b000 | PTE_P | PTE_W,
-	0x59c000 | PTE_P | PTE_W,
-	0x59d000 | PTE_P | PTE_W,
-	0x59e000 | PTE_P | PTE_W,
-	0x59f000 | PTE_P | PTE_W,
-	0x5a0000 | PTE_P | PTE_W,
-	0x5a1000 | PTE_P | PTE_W,
-	0x5a2000 | PTE_P | PTE_W,
-	0x5a3000 | PTE_P | PTE_W,
-	0x5a4000 | PTE_P | PTE_W,
-	0x5a5000 | PTE_P | PTE_W,
-	0x5a6000 | PTE_P | PTE_W,
-	0x5a7000 | PTE_P | PTE_W,
-	0x5a8000 | PTE_P | PTE_W,
-	0x5a9000 | PTE_P | PTE_W,
-	0x5aa000 | PTE_P | PTE_W,
-	0x5ab000 | PTE_P | PTE_W,
-	0x5ac000 | PTE_P | PTE_W,
-	0x5ad000 | PTE_P | PTE_W,
-	0x5ae000 | PTE_P | PTE_W,
-	0x5af000 | PTE_P | PTE_W,
-	0x5b0000 | PTE_P | PTE_W,
-	0x5b1000 | PTE_P | PTE_W,
-	0x5b2000 | PTE_P | PTE_W,
-	0x5b3000 | PTE_P | PTE_W,
-	0x5b4000 | PTE_P | PTE_W,
-	0x5b5000 | PTE_P | PTE_W,
-	0x5b6000 | PTE_P | PTE_W,
-	0x5b7000 | PTE_P | PTE_W,
-	0x5b8000 | PTE_P | PTE_W,
-	0x5b9000 | PTE_P | PTE_W,
-	0x5ba000 | PTE_P | PTE_W,
-	0x5bb000 | PTE_P | PTE_W,
-	0x5bc000 | PTE_P | PTE_W,
-	0x5bd000 | PTE_P | PTE_W,
-	0x5be000 | PTE_P | PTE_W,
-	0x5bf000 | PTE_P | PTE_W,
-	0x5c0000 | PTE_P | PTE_W,
-	0x5c1000 | PTE_P | PTE_W,
-	0x5c2000 | PTE_P | PTE_W,
-	0x5c3000 | PTE_P | PTE_W,
-	0x5c4000 | PTE_P | PTE_W,
-	0x5c5000 | PTE_P | PTE_W,
-	0x5c6000 | PTE_P | PTE_W,
-	0x5c7000 | PTE_P | PTE_W,
-	0x5c8000 | PTE_P | PTE_W,
-	0x5c9000 | PTE_P | PTE_W,
-	0x5ca000 | PTE_P | PTE_W,
-	0x5cb000 | PTE_P | PTE_W,
-	0x5cc000 | PTE_P | PTE_W,
-	0x5cd000 | PTE_P | PTE_W,
-	0x5ce000 | PTE_P | PTE_W,
-	0x5cf000 | PTE_P | PTE_W,
-	0x5d0000 | PTE_P | PTE_W,
-	0x5d1000 | PTE_P | PTE_W,
-	0x5d2000 | PTE_P | PTE_W,
-	0x5d3000 | PTE_P | PTE_W,
-	0x5d4000 | PTE_P | PTE_W,
-	0x5d5000 | PTE_P | PTE_W,
-	0x5d6000 | PTE_P | PTE_W,
-	0x5d7000 | PTE_P | PTE_W,
-	0x5d8000 | PTE_P | PTE_W,
-	0x5d9000 | PTE_P | PTE_W,
-	0x5da000 | PTE_P | PTE_W,
-	0x5db000 | PTE_P | PTE_W,
-	0x5dc000 | PTE_P | PTE_W,
-	0x5dd000 | PTE_P | PTE_W,
-	0x5de000 | PTE_P | PTE_W,
-	0x5df000 | PTE_P | PTE_W,
-	0x5e0000 | PTE_P | PTE_W,
-	0x5e1000 | PTE_P | PTE_W,
-	0x5e2000 | PTE_P | PTE_W,
-	0x5e3000 | PTE_P | PTE_W,
-	0x5e4000 | PTE_P | PTE_W,
-	0x5e5000 | PTE_P | PTE_W,
-	0x5e6000 | PTE_P | PTE_W,
-	0x5e7000 | PTE_P | PTE_W,
-	0x5e8000 | PTE_P | PTE_W,
-	0x5e9000 | PTE_P | PTE_W,
-	0x5ea000 | PTE_P | PTE_W,
-	0x5eb000 | PTE_P | PTE_W,
-	0x5ec000 | PTE_P | PTE_W,
-	0x5ed000 | PTE_P | PTE_W,
-	0x5ee000 | PTE_P | PTE_W,
-	0x5ef000 | PTE_P | PTE_W,
-	0x5f0000 | PTE_P | PTE_W,
-	0x5f1000 | PTE_P | PTE_W,
-	0x5f2000 | PTE_P | PTE_W,
-	0x5f3000 | PTE_P | PTE_W,
-	0x5f4000 | PTE_P | PTE_W,
-	0x5f5000 | PTE_P | PTE_W,
-	0x5f6000 | PTE_P | PTE_W,
-	0x5f7000 | PTE_P | PTE_W,
-	0x5f8000 | PTE_P | PTE_W,
-	0x5f9000 | PTE_P | PTE_W,
-	0x5fa000 | PTE_P | PTE_W,
-	0x5fb000 | PTE_P | PTE_W,
-	0x5fc000 | PTE_P | PTE_W,
-	0x5fd000 | PTE_P | PTE_W,
-	0x5fe000 | PTE_P | PTE_W,
-	0x5ff000 | PTE_P | PTE_W,
-	0x600000 | PTE_P | PTE_W,
-	0x601000 | PTE_P | PTE_W,
-	0x602000 | PTE_P | PTE_W,
-	0x603000 | PTE_P | PTE_W,
-	0x604000 | PTE_P | PTE_W,
-	0x605000 | PTE_P | PTE_W,
-	0x606000 | PTE_P | PTE_W,
-	0x607000 | PTE_P | PTE_W,
-	0x608000 | PTE_P | PTE_W,
-	0x609000 | PTE_P | PTE_W,
-	0x60a000 | PTE_P | PTE_W,
-	0x60b000 | PTE_P | PTE_W,
-	0x60c000 | PTE_P | PTE_W,
-	0x60d000 | PTE_P | PTE_W,
-	0x60e000 | PTE_P | PTE_W,
-	0x60f000 | PTE_P | PTE_W,
-	0x610000 | PTE_P | PTE_W,
-	0x611000 | PTE_P | PTE_W,
-	0x612000 | PTE_P | PTE_W,
-	0x613000 | PTE_P | PTE_W,
-	0x614000 | PTE_P | PTE_W,
-	0x615000 | PTE_P | PTE_W,
-	0x616000 | PTE_P | PTE_W,
-	0x617000 | PTE_P | PTE_W,
-	0x618000 | PTE_P | PTE_W,
-	0x619000 | PTE_P | PTE_W,
-	0x61a000 | PTE_P | PTE_W,
-	0x61b000 | PTE_P | PTE_W,
-	0x61c000 | PTE_P | PTE_W,
-	0x61d000 | PTE_P | PTE_W,
-	0x61e000 | PTE_P | PTE_W,
-	0x61f000 | PTE_P | PTE_W,
-	0x620000 | PTE_P | PTE_W,
-	0x621000 | PTE_P | PTE_W,
-	0x622000 | PTE_P | PTE_W,
-	0x623000 | PTE_P | PTE_W,
-	0x624000 | PTE_P | PTE_W,
-	0x625000 | PTE_P | PTE_W,
-	0x626000 | PTE_P | PTE_W,
-	0x627000 | PTE_P | PTE_W,
-	0x628000 | PTE_P | PTE_W,
-	0x629000 | PTE_P | PTE_W,
-	0x62a000 | PTE_P | PTE_W,
-	0x62b000 | PTE_P | PTE_W,
-	0x62c000 | PTE_P | PTE_W,
-	0x62d000 | PTE_P | PTE_W,
-	0x62e000 | PTE_P | PTE_W,
-	0x62f000 | PTE_P | PTE_W,
-	0x630000 | PTE_P | PTE_W,
-	0x631000 | PTE_P | PTE_W,
-	0x632000 | PTE_P | PTE_W,
-	0x633000 | PTE_P | PTE_W,
-	0x634000 | PTE_P | PTE_W,
-	0x635000 | PTE_P | PTE_W,
-	0x636000 | PTE_P | PTE_W,
-	0x637000 | PTE_P | PTE_W,
-	0x638000 | PTE_P | PTE_W,
-	0x639000 | PTE_P | PTE_W,
-	0x63a000 | PTE_P | PTE_W,
-	0x63b000 | PTE_P | PTE_W,
-	0x63c000 | PTE_P | PTE_W,
-	0x63d000 | PTE_P | PTE_W,
-	0x63e000 | PTE_P | PTE_W,
-	0x63f000 | PTE_P | PTE_W,
-	0x640000 | PTE_P | PTE_W,
-	0x641000 | PTE_P | PTE_W,
-	0x642000 | PTE_P | PTE_W,
-	0x643000 | PTE_P | PTE_W,
-	0x644000 | PTE_P | PTE_W,
-	0x645000 | PTE_P | PTE_W,
-	0x646000 | PTE_P | PTE_W,
-	0x647000 | PTE_P | PTE_W,
-	0x648000 | PTE_P | PTE_W,
-	0x649000 | PTE_P | PTE_W,
-	0x64a000 | PTE_P | PTE_W,
-	0x64b000 | PTE_P | PTE_W,
-	0x64c000 | PTE_P | PTE_W,
-	0x64d000 | PTE_P | PTE_W,
-	0x64e000 | PTE_P | PTE_W,
-	0x64f000 | PTE_P | PTE_W,
-	0x650000 | PTE_P | PTE_W,
-	0x651000 | PTE_P | PTE_W,
-	0x652000 | PTE_P | PTE_W,
-	0x653000 | PTE_P | PTE_W,
-	0x654000 | PTE_P | PTE_W,
-	0x655000 | PTE_P | PTE_W,
-	0x656000 | PTE_P | PTE_W,
-	0x657000 | PTE_P | PTE_W,
-	0x658000 | PTE_P | PTE_W,
-	0x659000 | PTE_P | PTE_W,
-	0x65a000 | PTE_P | PTE_W,
-	0x65b000 | PTE_P | PTE_W,
-	0x65c000 | PTE_P | PTE_W,
-	0x65d000 | PTE_P | PTE_W,
-	0x65e000 | PTE_P | PTE_W,
-	0x65f000 | PTE_P | PTE_W,
-	0x660000 | PTE_P | PTE_W,
-	0x661000 | PTE_P | PTE_W,
-	0x662000 | PTE_P | PTE_W,
-	0x663000 | PTE_P | PTE_W,
-	0x664000 | PTE_P | PTE_W,
-	0x665000 | PTE_P | PTE_W,
-	0x666000 | PTE_P | PTE_W,
-	0x667000 | PTE_P | PTE_W,
-	0x668000 | PTE_P | PTE_W,
-	0x669000 | PTE_P | PTE_W,
-	0x66a000 | PTE_P | PTE_W,
-	0x66b000 | PTE_P | PTE_W,
-	0x66c000 | PTE_P | PTE_W,
-	0x66d000 | PTE_P | PTE_W,
-	0x66e000 | PTE_P | PTE_W,
-	0x66f000 | PTE_P | PTE_W,
-	0x670000 | PTE_P | PTE_W,
-	0x671000 | PTE_P | PTE_W,
-	0x672000 | PTE_P | PTE_W,
-	0x673000 | PTE_P | PTE_W,
-	0x674000 | PTE_P | PTE_W,
-	0x675000 | PTE_P | PTE_W,
-	0x676000 | PTE_P | PTE_W,
-	0x677000 | PTE_P | PTE_W,
-	0x678000 | PTE_P | PTE_W,
-	0x679000 | PTE_P | PTE_W,
-	0x67a000 | PTE_P | PTE_W,
-	0x67b000 | PTE_P | PTE_W,
-	0x67c000 | PTE_P | PTE_W,
-	0x67d000 | PTE_P | PTE_W,
-	0x67e000 | PTE_P | PTE_W,
-	0x67f000 | PTE_P | PTE_W,
-	0x680000 | PTE_P | PTE_W,
-	0x681000 | PTE_P | PTE_W,
-	0x682000 | PTE_P | PTE_W,
-	0x683000 | PTE_P | PTE_W,
-	0x684000 | PTE_P | PTE_W,
-	0x685000 | PTE_P | PTE_W,
-	0x686000 | PTE_P | PTE_W,
-	0x687000 | PTE_P | PTE_W,
-	0x688000 | PTE_P | PTE_W,
-	0x689000 | PTE_P | PTE_W,
-	0x68a000 | PTE_P | PTE_W,
-	0x68b000 | PTE_P | PTE_W,
-	0x68c000 | PTE_P | PTE_W,
-	0x68d000 | PTE_P | PTE_W,
-	0x68e000 | PTE_P | PTE_W,
-	0x68f000 | PTE_P | PTE_W,
-	0x690000 | PTE_P | PTE_W,
-	0x691000 | PTE_P | PTE_W,
-	0x692000 | PTE_P | PTE_W,
-	0x693000 | PTE_P | PTE_W,
-	0x694000 | PTE_P | PTE_W,
-	0x695000 | PTE_P | PTE_W,
-	0x696000 | PTE_P | PTE_W,
-	0x697000 | PTE_P | PTE_W,
-	0x698000 | PTE_P | PTE_W,
-	0x699000 | PTE_P | PTE_W,
-	0x69a000 | PTE_P | PTE_W,
-	0x69b000 | PTE_P | PTE_W,
-	0x69c000 | PTE_P | PTE_W,
-	0x69d000 | PTE_P | PTE_W,
-	0x69e000 | PTE_P | PTE_W,
-	0x69f000 | PTE_P | PTE_W,
-	0x6a0000 | PTE_P | PTE_W,
-	0x6a1000 | PTE_P | PTE_W,
-	0x6a2000 | PTE_P | PTE_W,
-	0x6a3000 | PTE_P | PTE_W,
-	0x6a4000 | PTE_P | PTE_W,
-	0x6a5000 | PTE_P | PTE_W,
-	0x6a6000 | PTE_P | PTE_W,
-	0x6a7000 | PTE_P | PTE_W,
-	0x6a8000 | PTE_P | PTE_W,
-	0x6a9000 | PTE_P | PTE_W,
-	0x6aa000 | PTE_P | PTE_W,
-	0x6ab000 | PTE_P | PTE_W,
-	0x6ac000 | PTE_P | PTE_W,
-	0x6ad000 | PTE_P | PTE_W,
-	0x6ae000 | PTE_P | PTE_W,
-	0x6af000 | PTE_P | PTE_W,
-	0x6b0000 | PTE_P | PTE_W,
-	0x6b1000 | PTE_P | PTE_W,
-	0x6b2000 | PTE_P | PTE_W,
-	0x6b3000 | PTE_P | PTE_W,
-	0x6b4000 | PTE_P | PTE_W,
-	0x6b5000 | PTE_P | PTE_W,
-	0x6b6000 | PTE_P | PTE_W,
-	0x6b7000 | PTE_P | PTE_W,
-	0x6b8000 | PTE_P | PTE_W,
-	0x6b9000 | PTE_P | PTE_W,
-	0x6ba000 | PTE_P | PTE_W,
-	0x6bb000 | PTE_P | PTE_W,
-	0x6bc000 | PTE_P | PTE_W,
-	0x6bd000 | PTE_P | PTE_W,
-	0x6be000 | PTE_P | PTE_W,
-	0x6bf000 | PTE_P | PTE_W,
-	0x6c0000 | PTE_P | PTE_W,
-	0x6c1000 | PTE_P | PTE_W,
-	0x6c2000 | PTE_P | PTE_W,
-	0x6c3000 | PTE_P | PTE_W,
-	0x6c4000 | PTE_P | PTE_W,
-	0x6c5000 | PTE_P | PTE_W,
-	0x6c6000 | PTE_P | PTE_W,
-	0x6c7000 | PTE_P | PTE_W,
-	0x6c8000 | PTE_P | PTE_W,
-	0x6c9000 | PTE_P | PTE_W,
-	0x6ca000 | PTE_P | PTE_W,
-	0x6cb000 | PTE_P | PTE_W,
-	0x6cc000 | PTE_P | PTE_W,
-	0x6cd000 | PTE_P | PTE_W,
-	0x6ce000 | PTE_P | PTE_W,
-	0x6cf000 | PTE_P | PTE_W,
-	0x6d0000 | PTE_P | PTE_W,
-	0x6d1000 | PTE_P | PTE_W,
-	0x6d2000 | PTE_P | PTE_W,
-	0x6d3000 | PTE_P | PTE_W,
-	0x6d4000 | PTE_P | PTE_W,
-	0x6d5000 | PTE_P | PTE_W,
-	0x6d6000 | PTE_P | PTE_W,
-	0x6d7000 | PTE_P | PTE_W,
-	0x6d8000 | PTE_P | PTE_W,
-	0x6d9000 | PTE_P | PTE_W,
-	0x6da000 | PTE_P | PTE_W,
-	0x6db000 | PTE_P | PTE_W,
-	0x6dc000 | PTE_P | PTE_W,
-	0x6dd000 | PTE_P | PTE_W,
-	0x6de000 | PTE_P | PTE_W,
-	0x6df000 | PTE_P | PTE_W,
-	0x6e0000 | PTE_P | PTE_W,
-	0x6e1000 | PTE_P | PTE_W,
-	0x6e2000 | PTE_P | PTE_W,
-	0x6e3000 | PTE_P | PTE_W,
-	0x6e4000 | PTE_P | PTE_W,
-	0x6e5000 | PTE_P | PTE_W,
-	0x6e6000 | PTE_P | PTE_W,
-	0x6e7000 | PTE_P | PTE_W,
-	0x6e8000 | PTE_P | PTE_W,
-	0x6e9000 | PTE_P | PTE_W,
-	0x6ea000 | PTE_P | PTE_W,
-	0x6eb000 | PTE_P | PTE_W,
-	0x6ec000 | PTE_P | PTE_W,
-	0x6ed000 | PTE_P | PTE_W,
-	0x6ee000 | PTE_P | PTE_W,
-	0x6ef000 | PTE_P | PTE_W,
-	0x6f0000 | PTE_P | PTE_W,
-	0x6f1000 | PTE_P | PTE_W,
-	0x6f2000 | PTE_P | PTE_W,
-	0x6f3000 | PTE_P | PTE_W,
-	0x6f4000 | PTE_P | PTE_W,
-	0x6f5000 | PTE_P | PTE_W,
-	0x6f6000 | PTE_P | PTE_W,
-	0x6f7000 | PTE_P | PTE_W,
-	0x6f8000 | PTE_P | PTE_W,
-	0x6f9000 | PTE_P | PTE_W,
-	0x6fa000 | PTE_P | PTE_W,
-	0x6fb000 | PTE_P | PTE_W,
-	0x6fc000 | PTE_P | PTE_W,
-	0x6fd000 | PTE_P | PTE_W,
-	0x6fe000 | PTE_P | PTE_W,
-	0x6ff000 | PTE_P | PTE_W,
-	0x700000 | PTE_P | PTE_W,
-	0x701000 | PTE_P | PTE_W,
-	0x702000 | PTE_P | PTE_W,
-	0x703000 | PTE_P | PTE_W,
-	0x704000 | PTE_P | PTE_W,
-	0x705000 | PTE_P | PTE_W,
-	0x706000 | PTE_P | PTE_W,
-	0x707000 | PTE_P | PTE_W,
-	0x708000 | PTE_P | PTE_W,
-	0x709000 | PTE_P | PTE_W,
-	0x70a000 | PTE_P | PTE_W,
-	0x70b000 | PTE_P | PTE_W,
-	0x70c000 | PTE_P | PTE_W,
-	0x70d000 | PTE_P | PTE_W,
-	0x70e000 | PTE_P | PTE_W,
-	0x70f000 | PTE_P | PTE_W,
-	0x710000 | PTE_P | PTE_W,
-	0x711000 | PTE_P | PTE_W,
-	0x712000 | PTE_P | PTE_W,
-	0x713000 | PTE_P | PTE_W,
-	0x714000 | PTE_P | PTE_W,
-	0x715000 | PTE_P | PTE_W,
-	0x716000 | PTE_P | PTE_W,
-	0x717000 | PTE_P | PTE_W,
-	0x718000 | PTE_P | PTE_W,
-	0x719000 | PTE_P | PTE_W,
-	0x71a000 | PTE_P | PTE_W,
-	0x71b000 | PTE_P | PTE_W,
-	0x71c000 | PTE_P | PTE_W,
-	0x71d000 | PTE_P | PTE_W,
-	0x71e000 | PTE_P | PTE_W,
-	0x71f000 | PTE_P | PTE_W,
-	0x720000 | PTE_P | PTE_W,
-	0x721000 | PTE_P | PTE_W,
-	0x722000 | PTE_P | PTE_W,
-	0x723000 | PTE_P | PTE_W,
-	0x724000 | PTE_P | PTE_W,
-	0x725000 | PTE_P | PTE_W,
-	0x726000 | PTE_P | PTE_W,
-	0x727000 | PTE_P | PTE_W,
-	0x728000 | PTE_P | PTE_W,
-	0x729000 | PTE_P | PTE_W,
-	0x72a000 | PTE_P | PTE_W,
-	0x72b000 | PTE_P | PTE_W,
-	0x72c000 | PTE_P | PTE_W,
-	0x72d000 | PTE_P | PTE_W,
-	0x72e000 | PTE_P | PTE_W,
-	0x72f000 | PTE_P | PTE_W,
-	0x730000 | PTE_P | PTE_W,
-	0x731000 | PTE_P | PTE_W,
-	0x732000 | PTE_P | PTE_W,
-	0x733000 | PTE_P | PTE_W,
-	0x734000 | PTE_P | PTE_W,
-	0x735000 | PTE_P | PTE_W,
-	0x736000 | PTE_P | PTE_W,
-	0x737000 | PTE_P | PTE_W,
-	0x738000 | PTE_P | PTE_W,
-	0x739000 | PTE_P | PTE_W,
-	0x73a000 | PTE_P | PTE_W,
-	0x73b000 | PTE_P | PTE_W,
-	0x73c000 | PTE_P | PTE_W,
-	0x73d000 | PTE_P | PTE_W,
-	0x73e000 | PTE_P | PTE_W,
-	0x73f000 | PTE_P | PTE_W,
-	0x740000 | PTE_P | PTE_W,
-	0x741000 | PTE_P | PTE_W,
-	0x742000 | PTE_P | PTE_W,
-	0x743000 | PTE_P | PTE_W,
-	0x744000 | PTE_P | PTE_W,
-	0x745000 | PTE_P | PTE_W,
-	0x746000 | PTE_P | PTE_W,
-	0x747000 | PTE_P | PTE_W,
-	0x748000 | PTE_P | PTE_W,
-	0x749000 | PTE_P | PTE_W,
-	0x74a000 | PTE_P | PTE_W,
-	0x74b000 | PTE_P | PTE_W,
-	0x74c000 | PTE_P | PTE_W,
-	0x74d000 | PTE_P | PTE_W,
-	0x74e000 | PTE_P | PTE_W,
-	0x74f000 | PTE_P | PTE_W,
-	0x750000 | PTE_P | PTE_W,
-	0x751000 | PTE_P | PTE_W,
-	0x752000 | PTE_P | PTE_W,
-	0x753000 | PTE_P | PTE_W,
-	0x754000 | PTE_P | PTE_W,
-	0x755000 | PTE_P | PTE_W,
-	0x756000 | PTE_P | PTE_W,
-	0x757000 | PTE_P | PTE_W,
-	0x758000 | PTE_P | PTE_W,
-	0x759000 | PTE_P | PTE_W,
-	0x75a000 | PTE_P | PTE_W,
-	0x75b000 | PTE_P | PTE_W,
-	0x75c000 | PTE_P | PTE_W,
-	0x75d000 | PTE_P | PTE_W,
-	0x75e000 | PTE_P | PTE_W,
-	0x75f000 | PTE_P | PTE_W,
-	0x760000 | PTE_P | PTE_W,
-	0x761000 | PTE_P | PTE_W,
-	0x762000 | PTE_P | PTE_W,
-	0x763000 | PTE_P | PTE_W,
-	0x764000 | PTE_P | PTE_W,
-	0x765000 | PTE_P | PTE_W,
-	0x766000 | PTE_P | PTE_W,
-	0x767000 | PTE_P | PTE_W,
-	0x768000 | PTE_P | PTE_W,
-	0x769000 | PTE_P | PTE_W,
-	0x76a000 | PTE_P | PTE_W,
-	0x76b000 | PTE_P | PTE_W,
-	0x76c000 | PTE_P | PTE_W,
-	0x76d000 | PTE_P | PTE_W,
-	0x76e000 | PTE_P | PTE_W,
-	0x76f000 | PTE_P | PTE_W,
-	0x770000 | PTE_P | PTE_W,
-	0x771000 | PTE_P | PTE_W,
-	0x772000 | PTE_P | PTE_W,
-	0x773000 | PTE_P | PTE_W,
-	0x774000 | PTE_P | PTE_W,
-	0x775000 | PTE_P | PTE_W,
-	0x776000 | PTE_P | PTE_W,
-	0x777000 | PTE_P | PTE_W,
-	0x778000 | PTE_P | PTE_W,
-	0x779000 | PTE_P | PTE_W,
-	0x77a000 | PTE_P | PTE_W,
-	0x77b000 | PTE_P | PTE_W,
-	0x77c000 | PTE_P | PTE_W,
-	0x77d000 | PTE_P | PTE_W,
-	0x77e000 | PTE_P | PTE_W,
-	0x77f000 | PTE_P | PTE_W,
-	0x780000 | PTE_P | PTE_W,
-	0x781000 | PTE_P | PTE_W,
-	0x782000 | PTE_P | PTE_W,
-	0x783000 | PTE_P | PTE_W,
-	0x784000 | PTE_P | PTE_W,
-	0x785000 | PTE_P | PTE_W,
-	0x786000 | PTE_P | PTE_W,
-	0x787000 | PTE_P | PTE_W,
-	0x788000 | PTE_P | PTE_W,
-	0x789000 | PTE_P | PTE_W,
-	0x78a000 | PTE_P | PTE_W,
-	0x78b000 | PTE_P | PTE_W,
-	0x78c000 | PTE_P | PTE_W,
-	0x78d000 | PTE_P | PTE_W,
-	0x78e000 | PTE_P | PTE_W,
-	0x78f000 | PTE_P | PTE_W,
-	0x790000 | PTE_P | PTE_W,
-	0x791000 | PTE_P | PTE_W,
-	0x792000 | PTE_P | PTE_W,
-	0x793000 | PTE_P | PTE_W,
-	0x794000 | PTE_P | PTE_W,
-	0x795000 | PTE_P | PTE_W,
-	0x796000 | PTE_P | PTE_W,
-	0x797000 | PTE_P | PTE_W,
-	0x798000 | PTE_P | PTE_W,
-	0x799000 | PTE_P | PTE_W,
-	0x79a000 | PTE_P | PTE_W,
-	0x79b000 | PTE_P | PTE_W,
-	0x79c000 | PTE_P | PTE_W,
-	0x79d000 | PTE_P | PTE_W,
-	0x79e000 | PTE_P | PTE_W,
-	0x79f000 | PTE_P | PTE_W,
-	0x7a0000 | PTE_P | PTE_W,
-	0x7a1000 | PTE_P | PTE_W,
-	0x7a2000 | PTE_P | PTE_W,
-	0x7a3000 | PTE_P | PTE_W,
-	0x7a4000 | PTE_P | PTE_W,
-	0x7a5000 | PTE_P | PTE_W,
-	0x7a6000 | PTE_P | PTE_W,
-	0x7a7000 | PTE_P | PTE_W,
-	0x7a8000 | PTE_P | PTE_W,
-	0x7a9000 | PTE_P | PTE_W,
-	0x7aa000 | PTE_P | PTE_W,
-	0x7ab000 | PTE_P | PTE_W,
-	0x7ac000 | PTE_P | PTE_W,
-	0x7ad000 | PTE_P | PTE_W,
-	0x7ae000 | PTE_P | PTE_W,
-	0x7af000 | PTE_P | PTE_W,
-	0x7b0000 | PTE_P | PTE_W,
-	0x7b1000 | PTE_P | PTE_W,
-	0x7b2000 | PTE_P | PTE_W,
-	0x7b3000 | PTE_P | PTE_W,
-	0x7b4000 | PTE_P | PTE_W,
-	0x7b5000 | PTE_P | PTE_W,
-	0x7b6000 | PTE_P | PTE_W,
-	0x7b7000 | PTE_P | PTE_W,
-	0x7b8000 | PTE_P | PTE_W,
-	0x7b9000 | PTE_P | PTE_W,
-	0x7ba000 | PTE_P | PTE_W,
-	0x7bb000 | PTE_P | PTE_W,
-	0x7bc000 | PTE_P | PTE_W,
-	0x7bd000 | PTE_P | PTE_W,
-	0x7be000 | PTE_P | PTE_W,
-	0x7bf000 | PTE_P | PTE_W,
-	0x7c0000 | PTE_P | PTE_W,
-	0x7c1000 | PTE_P | PTE_W,
-	0x7c2000 | PTE_P | PTE_W,
-	0x7c3000 | PTE_P | PTE_W,
-	0x7c4000 | PTE_P | PTE_W,
-	0x7c5000 | PTE_P | PTE_W,
-	0x7c6000 | PTE_P | PTE_W,
-	0x7c7000 | PTE_P | PTE_W,
-	0x7c8000 | PTE_P | PTE_W,
-	0x7c9000 | PTE_P | PTE_W,
-	0x7ca000 | PTE_P | PTE_W,
-	0x7cb000 | PTE_P | PTE_W,
-	0x7cc000 | PTE_P | PTE_W,
-	0x7cd000 | PTE_P | PTE_W,
-	0x7ce000 | PTE_P | PTE_W,
-	0x7cf000 | PTE_P | PTE_W,
-	0x7d0000 | PTE_P | PTE_W,
-	0x7d1000 | PTE_P | PTE_W,
-	0x7d2000 | PTE_P | PTE_W,
-	0x7d3000 | PTE_P | PTE_W,
-	0x7d4000 | PTE_P | PTE_W,
-	0x7d5000 | PTE_P | PTE_W,
-	0x7d6000 | PTE_P | PTE_W,
-	0x7d7000 | PTE_P | PTE_W,
-	0x7d8000 | PTE_P | PTE_W,
-	0x7d9000 | PTE_P | PTE_W,
-	0x7da000 | PTE_P | PTE_W,
-	0x7db000 | PTE_P | PTE_W,
-	0x7dc000 | PTE_P | PTE_W,
-	0x7dd000 | PTE_P | PTE_W,
-	0x7de000 | PTE_P | PTE_W,
-	0x7df000 | PTE_P | PTE_W,
-	0x7e0000 | PTE_P | PTE_W,
-	0x7e1000 | PTE_P | PTE_W,
-	0x7e2000 | PTE_P | PTE_W,
-	0x7e3000 | PTE_P | PTE_W,
-	0x7e4000 | PTE_P | PTE_W,
-	0x7e5000 | PTE_P | PTE_W,
-	0x7e6000 | PTE_P | PTE_W,
-	0x7e7000 | PTE_P | PTE_W,
-	0x7e8000 | PTE_P | PTE_W,
-	0x7e9000 | PTE_P | PTE_W,
-	0x7ea000 | PTE_P | PTE_W,
-	0x7eb000 | PTE_P | PTE_W,
-	0x7ec000 | PTE_P | PTE_W,
-	0x7ed000 | PTE_P | PTE_W,
-	0x7ee000 | PTE_P | PTE_W,
-	0x7ef000 | PTE_P | PTE_W,
-	0x7f0000 | PTE_P | PTE_W,
-	0x7f1000 | PTE_P | PTE_W,
-	0x7f2000 | PTE_P | PTE_W,
-	0x7f3000 | PTE_P | PTE_W,
-	0x7f4000 | PTE_P | PTE_W,
-	0x7f5000 | PTE_P | PTE_W,
-	0x7f6000 | PTE_P | PTE_W,
-	0x7f7000 | PTE_P | PTE_W,
-	0x7f8000 | PTE_P | PTE_W,
-	0x7f9000 | PTE_P | PTE_W,
-	0x7fa000 | PTE_P | PTE_W,
-	0x7fb000 | PTE_P | PTE_W,
-	0x7fc000 | PTE_P | PTE_W,
-	0x7fd000 | PTE_P | PTE_W,
-	0x7fe000 | PTE_P | PTE_W,
-	0x7ff000 | PTE_P | PTE_W,
-};
-
-
-__attribute__((__aligned__(PGSIZE)))
-pte_t entry_pgtable2[NPTENTRIES] = {
-	0x800000 | PTE_P | PTE_W,
-	0x801000 | PTE_P | PTE_W,
-	0x802000 | PTE_P | PTE_W,
-	0x803000 | PTE_P | PTE_W,
-	0x804000 | PTE_P | PTE_W,
-	0x805000 | PTE_P | PTE_W,
-	0x806000 | PTE_P | PTE_W,
-	0x807000 | PTE_P | PTE_W,
-	0x808000 | PTE_P | PTE_W,
-	0x809000 | PTE_P | PTE_W,
-	0x80a000 | PTE_P | PTE_W,
-	0x80b000 | PTE_P | PTE_W,
-	0x80c000 | PTE_P | PTE_W,
-	0x80d000 | PTE_P | PTE_W,
-	0x80e000 | PTE_P | PTE_W,
-	0x80f000 | PTE_P | PTE_W,
-	0x810000 | PTE_P | PTE_W,
-	0x811000 | PTE_P | PTE_W,
-	0x812000 | PTE_P | PTE_W,
-	0x813000 | PTE_P | PTE_W,
-	0x814000 | PTE_P | PTE_W,
-	0x815000 | PTE_P | PTE_W,
-	0x816000 | PTE_P | PTE_W,
-	0x817000 | PTE_P | PTE_W,
-	0x818000 | PTE_P | PTE_W,
-	0x819000 | PTE_P | PTE_W,
-	0x81a000 | PTE_P | PTE_W,
-	0x81b000 | PTE_P | PTE_W,
-	0x81c000 | PTE_P | PTE_W,
-	0x81d000 | PTE_P | PTE_W,
-	0x81e000 | PTE_P | PTE_W,
-	0x81f000 | PTE_P | PTE_W,
-	0x820000 | PTE_P | PTE_W,
-	0x821000 | PTE_P | PTE_W,
-	0x822000 | PTE_P | PTE_W,
-	0x823000 | PTE_P | PTE_W,
-	0x824000 | PTE_P | PTE_W,
-	0x825000 | PTE_P | PTE_W,
-	0x826000 | PTE_P | PTE_W,
-	0x827000 | PTE_P | PTE_W,
-	0x828000 | PTE_P | PTE_W,
-	0x829000 | PTE_P | PTE_W,
-	0x82a000 | PTE_P | PTE_W,
-	0x82b000 | PTE_P | PTE_W,
-	0x82c000 | PTE_P | PTE_W,
-	0x82d000 | PTE_P | PTE_W,
-	0x82e000 | PTE_P | PTE_W,
-	0x82f000 | PTE_P | PTE_W,
-	0x830000 | PTE_P | PTE_W,
-	0x831000 | PTE_P | PTE_W,
-	0x832000 | PTE_P | PTE_W,
-	0x833000 | PTE_P | PTE_W,
-	0x834000 | PTE_P | PTE_W,
-	0x835000 | PTE_P | PTE_W,
-	0x836000 | PTE_P | PTE_W,
-	0x837000 | PTE_P | PTE_W,
-	0x838000 | PTE_P | PTE_W,
-	0x839000 | PTE_P | PTE_W,
-	0x83a000 | PTE_P | PTE_W,
-	0x83b000 | PTE_P | PTE_W,
-	0x83c000 | PTE_P | PTE_W,
-	0x83d000 | PTE_P | PTE_W,
-	0x83e000 | PTE_P | PTE_W,
-	0x83f000 | PTE_P | PTE_W,
-	0x840000 | PTE_P | PTE_W,
-	0x841000 | PTE_P | PTE_W,
-	0x842000 | PTE_P | PTE_W,
-	0x843000 | PTE_P | PTE_W,
-	0x844000 | PTE_P | PTE_W,
-	0x845000 | PTE_P | PTE_W,
-	0x846000 | PTE_P | PTE_W,
-	0x847000 | PTE_P | PTE_W,
-	0x848000 | PTE_P | PTE_W,
-	0x849000 | PTE_P | PTE_W,
-	0x84a000 | PTE_P | PTE_W,
-	0x84b000 | PTE_P | PTE_W,
-	0x84c000 | PTE_P | PTE_W,
-	0x84d000 | PTE_P | PTE_W,
-	0x84e000 | PTE_P | PTE_W,
-	0x84f000 | PTE_P | PTE_W,
-	0x850000 | PTE_P | PTE_W,
-	0x851000 | PTE_P | PTE_W,
-	0x852000 | PTE_P | PTE_W,
-	0x853000 | PTE_P | PTE_W,
-	0x854000 | PTE_P | PTE_W,
-	0x855000 | PTE_P | PTE_W,
-	0x856000 | PTE_P | PTE_W,
-	0x857000 | PTE_P | PTE_W,
-	0x858000 | PTE_P | PTE_W,
-	0x859000 | PTE_P | PTE_W,
-	0x85a000 | PTE_P | PTE_W,
-	0x85b000 | PTE_P | PTE_W,
-	0x85c000 | PTE_P | PTE_W,
-	0x85d000 | PTE_P | PTE_W,
-	0x85e000 | PTE_P | PTE_W,
-	0x85f000 | PTE_P | PTE_W,
-	0x860000 | PTE_P | PTE_W,
-	0x861000 | PTE_P | PTE_W,
-	0x862000 | PTE_P | PTE_W,
-	0x863000 | PTE_P | PTE_W,
-	0x864000 | PTE_P | PTE_W,
-	0x865000 | PTE_P | PTE_W,
-	0x866000 | PTE_P | PTE_W,
-	0x867000 | PTE_P | PTE_W,
-	0x868000 | PTE_P | PTE_W,
-	0x869000 | PTE_P | PTE_W,
-	0x86a000 | PTE_P | PTE_W,
-	0x86b000 | PTE_P | PTE_W,
-	0x86c000 | PTE_P | PTE_W,
-	0x86d000 | PTE_P | PTE_W,
-	0x86e000 | PTE_P | PTE_W,
-	0x86f000 | PTE_P | PTE_W,
-	0x870000 | PTE_P | PTE_W,
-	0x871000 | PTE_P | PTE_W,
-	0x872000 | PTE_P | PTE_W,
-	0x873000 | PTE_P | PTE_W,
-	0x874000 | PTE_P | PTE_W,
-	0x875000 | PTE_P | PTE_W,
-	0x876000 | PTE_P | PTE_W,
-	0x877000 | PTE_P | PTE_W,
-	0x878000 | PTE_P | PTE_W,
-	0x879000 | PTE_P | PTE_W,
-	0x87a000 | PTE_P | PTE_W,
-	0x87b000 | PTE_P | PTE_W,
-	0x87c000 | PTE_P | PTE_W,
-	0x87d000 | PTE_P | PTE_W,
-	0x87e000 | PTE_P | PTE_W,
-	0x87f000 | PTE_P | PTE_W,
-	0x880000 | PTE_P | PTE_W,
-	0x881000 | PTE_P | PTE_W,
-	0x882000 | PTE_P | PTE_W,
-	0x883000 | PTE_P | PTE_W,
-	0x884000 | PTE_P | PTE_W,
-	0x885000 | PTE_P | PTE_W,
-	0x886000 | PTE_P | PTE_W,
-	0x887000 | PTE_P | PTE_W,
-	0x888000 | PTE_P | PTE_W,
-	0x889000 | PTE_P | PTE_W,
-	0x88a000 | PTE_P | PTE_W,
-	0x88b000 | PTE_P | PTE_W,
-	0x88c000 | PTE_P | PTE_W,
-	0x88d000 | PTE_P | PTE_W,
-	0x88e000 | PTE_P | PTE_W,
-	0x88f000 | PTE_P | PTE_W,
-	0x890000 | PTE_P | PTE_W,
-	0x891000 | PTE_P | PTE_W,
-	0x892000 | PTE_P | PTE_W,
-	0x893000 | PTE_P | PTE_W,
-	0x894000 | PTE_P | PTE_W,
-	0x895000 | PTE_P | PTE_W,
-	0x896000 | PTE_P | PTE_W,
-	0x897000 | PTE_P | PTE_W,
-	0x898000 | PTE_P | PTE_W,
-	0x899000 | PTE_P | PTE_W,
-	0x89a000 | PTE_P | PTE_W,
-	0x89b000 | PTE_P | PTE_W,
-	0x89c000 | PTE_P | PTE_W,
-	0x89d000 | PTE_P | PTE_W,
-	0x89e000 | PTE_P | PTE_W,
-	0x89f000 | PTE_P | PTE_W,
-	0x8a0000 | PTE_P | PTE_W,
-	0x8a1000 | PTE_P | PTE_W,
-	0x8a2000 | PTE_P | PTE_W,
-	0x8a3000 | PTE_P | PTE_W,
-	0x8a4000 | PTE_P | PTE_W,
-	0x8a5000 | PTE_P | PTE_W,
-	0x8a6000 | PTE_P | PTE_W,
-	0x8a7000 | PTE_P | PTE_W,
-	0x8a8000 | PTE_P | PTE_W,
-	0x8a9000 | PTE_P | PTE_W,
-	0x8aa000 | PTE_P | PTE_W,
-	0x8ab000 | PTE_P | PTE_W,
-	0x8ac000 | PTE_P | PTE_W,
-	0x8ad000 | PTE_P | PTE_W,
-	0x8ae000 | PTE_P | PTE_W,
-	0x8af000 | PTE_P | PTE_W,
-	0x8b0000 | PTE_P | PTE_W,
-	0x8b1000 | PTE_P | PTE_W,
-	0x8b2000 | PTE_P | PTE_W,
-	0x8b3000 | PTE_P | PTE_W,
-	0x8b4000 | PTE_P | PTE_W,
-	0x8b5000 | PTE_P | PTE_W,
-	0x8b6000 | PTE_P | PTE_W,
-	0x8b7000 | PTE_P | PTE_W,
-	0x8b8000 | PTE_P | PTE_W,
-	0x8b9000 | PTE_P | PTE_W,
-	0x8ba000 | PTE_P | PTE_W,
-	0x8bb000 | PTE_P | PTE_W,
-	0x8bc000 | PTE_P | PTE_W,
-	0x8bd000 | PTE_P | PTE_W,
-	0x8be000 | PTE_P | PTE_W,
-	0x8bf000 | PTE_P | PTE_W,
-	0x8c0000 | PTE_P | PTE_W,
-	0x8c1000 | PTE_P | PTE_W,
-	0x8c2000 | PTE_P | PTE_W,
-	0x8c3000 | PTE_P | PTE_W,
-	0x8c4000 | PTE_P | PTE_W,
-	0x8c5000 | PTE_P | PTE_W,
-	0x8c6000 | PTE_P | PTE_W,
-	0x8c7000 | PTE_P | PTE_W,
-	0x8c8000 | PTE_P | PTE_W,
-	0x8c9000 | PTE_P | PTE_W,
-	0x8ca000 | PTE_P | PTE_W,
-	0x8cb000 | PTE_P | PTE_W,
-	0x8cc000 | PTE_P | PTE_W,
-	0x8cd000 | PTE_P | PTE_W,
-	0x8ce000 | PTE_P | PTE_W,
-	0x8cf000 | PTE_P | PTE_W,
-	0x8d0000 | PTE_P | PTE_W,
-	0x8d1000 | PTE_P | PTE_W,
-	0x8d2000 | PTE_P | PTE_W,
-	0x8d3000 | PTE_P | PTE_W,
-	0x8d4000 | PTE_P | PTE_W,
-	0x8d5000 | PTE_P | PTE_W,
-	0x8d6000 | PTE_P | PTE_W,
-	0x8d7000 | PTE_P | PTE_W,
-	0x8d8000 | PTE_P | PTE_W,
-	0x8d9000 | PTE_P | PTE_W,
-	0x8da000 | PTE_P | PTE_W,
-	0x8db000 | PTE_P | PTE_W,
-	0x8dc000 | PTE_P | PTE_W,
-	0x8dd000 | PTE_P | PTE_W,
-	0x8de000 | PTE_P | PTE_W,
-	0x8df000 | PTE_P | PTE_W,
-	0x8e0000 | PTE_P | PTE_W,
-	0x8e1000 | PTE_P | PTE_W,
-	0x8e2000 | PTE_P | PTE_W,
-	0x8e3000 | PTE_P | PTE_W,
-	0x8e4000 | PTE_P | PTE_W,
-	0x8e5000 | PTE_P | PTE_W,
-	0x8e6000 | PTE_P | PTE_W,
-	0x8e7000 | PTE_P | PTE_W,
-	0x8e8000 | PTE_P | PTE_W,
-	0x8e9000 | PTE_P | PTE_W,
-	0x8ea000 | PTE_P | PTE_W,
-	0x8eb000 | PTE_P | PTE_W,
-	0x8ec000 | PTE_P | PTE_W,
-	0x8ed000 | PTE_P | PTE_W,
-	0x8ee000 | PTE_P | PTE_W,
-	0x8ef000 | PTE_P | PTE_W,
-	0x8f0000 | PTE_P | PTE_W,
-	0x8f1000 | PTE_P | PTE_W,
-	0x8f2000 | PTE_P | PTE_W,
-	0x8f3000 | PTE_P | PTE_W,
-	0x8f4000 | PTE_P | PTE_W,
-	0x8f5000 | PTE_P | PTE_W,
-	0x8f6000 | PTE_P | PTE_W,
-	0x8f7000 | PTE_P | PTE_W,
-	0x8f8000 | PTE_P | PTE_W,
-	0x8f9000 | PTE_P | PTE_W,
-	0x8fa000 | PTE_P | PTE_W,
-	0x8fb000 | PTE_P | PTE_W,
-	0x8fc000 | PTE_P | PTE_W,
-	0x8fd000 | PTE_P | PTE_W,
-	0x8fe000 | PTE_P | PTE_W,
-	0x8ff000 | PTE_P | PTE_W,
-	0x900000 | PTE_P | PTE_W,
-	0x901000 | PTE_P | PTE_W,
-	0x902000 | PTE_P | PTE_W,
-	0x903000 | PTE_P | PTE_W,
-	0x904000 | PTE_P | PTE_W,
-	0x905000 | PTE_P | PTE_W,
-	0x906000 | PTE_P | PTE_W,
-	0x907000 | PTE_P | PTE_W,
-	0x908000 | PTE_P | PTE_W,
-	0x909000 | PTE_P | PTE_W,
-	0x90a000 | PTE_P | PTE_W,
-	0x90b000 | PTE_P | PTE_W,
-	0x90c000 | PTE_P | PTE_W,
-	0x90d000 | PTE_P | PTE_W,
-	0x90e000 | PTE_P | PTE_W,
-	0x90f000 | PTE_P | PTE_W,
-	0x910000 | PTE_P | PTE_W,
-	0x911000 | PTE_P | PTE_W,
-	0x912000 | PTE_P | PTE_W,
-	0x913000 | PTE_P | PTE_W,
-	0x914000 | PTE_P | PTE_W,
-	0x915000 | PTE_P | PTE_W,
-	0x916000 | PTE_P | PTE_W,
-	0x917000 | PTE_P | PTE_W,
-	0x918000 | PTE_P | PTE_W,
-	0x919000 | PTE_P | PTE_W,
-	0x91a000 | PTE_P | PTE_W,
-	0x91b000 | PTE_P | PTE_W,
-	0x91c000 | PTE_P | PTE_W,
-	0x91d000 | PTE_P | PTE_W,
-	0x91e000 | PTE_P | PTE_W,
-	0x91f000 | PTE_P | PTE_W,
-	0x920000 | PTE_P | PTE_W,
-	0x921000 | PTE_P | PTE_W,
-	0x922000 | PTE_P | PTE_W,
-	0x923000 | PTE_P | PTE_W,
-	0x924000 | PTE_P | PTE_W,
-	0x925000 | PTE_P | PTE_W,
-	0x926000 | PTE_P | PTE_W,
-	0x927000 | PTE_P | PTE_W,
-	0x928000 | PTE_P | PTE_W,
-	0x929000 | PTE_P | PTE_W,
-	0x92a000 | PTE_P | PTE_W,
-	0x92b000 | PTE_P | PTE_W,
-	0x92c000 | PTE_P | PTE_W,
-	0x92d000 | PTE_P | PTE_W,
-	0x92e000 | PTE_P | PTE_W,
-	0x92f000 | PTE_P | PTE_W,
-	0x930000 | PTE_P | PTE_W,
-	0x931000 | PTE_P | PTE_W,
-	0x932000 | PTE_P | PTE_W,
-	0x933000 | PTE_P | PTE_W,
-	0x934000 | PTE_P | PTE_W,
-	0x935000 | PTE_P | PTE_W,
-	0x936000 | PTE_P | PTE_W,
-	0x937000 | PTE_P | PTE_W,
-	0x938000 | PTE_P | PTE_W,
-	0x939000 | PTE_P | PTE_W,
-	0x93a000 | PTE_P | PTE_W,
-	0x93b000 | PTE_P | PTE_W,
-	0x93c000 | PTE_P | PTE_W,
-	0x93d000 | PTE_P | PTE_W,
-	0x93e000 | PTE_P | PTE_W,
-	0x93f000 | PTE_P | PTE_W,
-	0x940000 | PTE_P | PTE_W,
-	0x941000 | PTE_P | PTE_W,
-	0x942000 | PTE_P | PTE_W,
-	0x943000 | PTE_P | PTE_W,
-	0x944000 | PTE_P | PTE_W,
-	0x945000 | PTE_P | PTE_W,
-	0x946000 | PTE_P | PTE_W,
-	0x947000 | PTE_P | PTE_W,
-	0x948000 | PTE_P | PTE_W,
-	0x949000 | PTE_P | PTE_W,
-	0x94a000 | PTE_P | PTE_W,
-	0x94b000 | PTE_P | PTE_W,
-	0x94c000 | PTE_P | PTE_W,
-	0x94d000 | PTE_P | PTE_W,
-	0x94e000 | PTE_P | PTE_W,
-	0x94f000 | PTE_P | PTE_W,
-	0x950000 | PTE_P | PTE_W,
-	0x951000 | PTE_P | PTE_W,
-	0x952000 | PTE_P | PTE_W,
-	0x953000 | PTE_P | PTE_W,
-	0x954000 | PTE_P | PTE_W,
-	0x955000 | PTE_P | PTE_W,
-	0x956000 | PTE_P | PTE_W,
-	0x957000 | PTE_P | PTE_W,
-	0x958000 | PTE_P | PTE_W,
-	0x959000 | PTE_P | PTE_W,
-	0x95a000 | PTE_P | PTE_W,
-	0x95b000 | PTE_P | PTE_W,
-	0x95c000 | PTE_P | PTE_W,
-	0x95d000 | PTE_P | PTE_W,
-	0x95e000 | PTE_P | PTE_W,
-	0x95f000 | PTE_P | PTE_W,
-	0x960000 | PTE_P | PTE_W,
-	0x961000 | PTE_P | PTE_W,
-	0x962000 | PTE_P | PTE_W,
-	0x963000 | PTE_P | PTE_W,
-	0x964000 | PTE_P | PTE_W,
-	0x965000 | PTE_P | PTE_W,
-	0x966000 | PTE_P | PTE_W,
-	0x967000 | PTE_P | PTE_W,
-	0x968000 | PTE_P | PTE_W,
-	0x969000 | PTE_P | PTE_W,
-	0x96a000 | PTE_P | PTE_W,
-	0x96b000 | PTE_P | PTE_W,
-	0x96c000 | PTE_P | PTE_W,
-	0x96d000 | PTE_P | PTE_W,
-	0x96e000 | PTE_P | PTE_W,
-	0x96f000 | PTE_P | PTE_W,
-	0x970000 | PTE_P | PTE_W,
-	0x971000 | PTE_P | PTE_W,
-	0x972000 | PTE_P | PTE_W,
-	0x973000 | PTE_P | PTE_W,
-	0x974000 | PTE_P | PTE_W,
-	0x975000 | PTE_P | PTE_W,
-	0x976000 | PTE_P | PTE_W,
-	0x977000 | PTE_P | PTE_W,
-	0x978000 | PTE_P | PTE_W,
-	0x979000 | PTE_P | PTE_W,
-	0x97a000 | PTE_P | PTE_W,
-	0x97b000 | PTE_P | PTE_W,
-	0x97c000 | PTE_P | PTE_W,
-	0x97d000 | PTE_P | PTE_W,
-	0x97e000 | PTE_P | PTE_W,
-	0x97f000 | PTE_P | PTE_W,
-	0x980000 | PTE_P | PTE_W,
-	0x981000 | PTE_P | PTE_W,
-	0x982000 | PTE_P | PTE_W,
-	0x983000 | PTE_P | PTE_W,
-	0x984000 | PTE_P | PTE_W,
-	0x985000 | PTE_P | PTE_W,
-	0x986000 | PTE_P | PTE_W,
-	0x987000 | PTE_P | PTE_W,
-	0x988000 | PTE_P | PTE_W,
-	0x989000 | PTE_P | PTE_W,
-	0x98a000 | PTE_P | PTE_W,
-	0x98b000 | PTE_P | PTE_W,
-	0x98c000 | PTE_P | PTE_W,
-	0x98d000 | PTE_P | PTE_W,
-	0x98e000 | PTE_P | PTE_W,
-	0x98f000 | PTE_P | PTE_W,
-	0x990000 | PTE_P | PTE_W,
-	0x991000 | PTE_P | PTE_W,
-	0x992000 | PTE_P | PTE_W,
-	0x993000 | PTE_P | PTE_W,
-	0x994000 | PTE_P | PTE_W,
-	0x995000 | PTE_P | PTE_W,
-	0x996000 | PTE_P | PTE_W,
-	0x997000 | PTE_P | PTE_W,
-	0x998000 | PTE_P | PTE_W,
-	0x999000 | PTE_P | PTE_W,
-	0x99a000 | PTE_P | PTE_W,
-	0x99b000 | PTE_P | PTE_W,
-	0x99c000 | PTE_P | PTE_W,
-	0x99d000 | PTE_P | PTE_W,
-	0x99e000 | PTE_P | PTE_W,
-	0x99f000 | PTE_P | PTE_W,
-	0x9a0000 | PTE_P | PTE_W,
-	0x9a1000 | PTE_P | PTE_W,
-	0x9a2000 | PTE_P | PTE_W,
-	0x9a3000 | PTE_P | PTE_W,
-	0x9a4000 | PTE_P | PTE_W,
-	0x9a5000 | PTE_P | PTE_W,
-	0x9a6000 | PTE_P | PTE_W,
-	0x9a7000 | PTE_P | PTE_W,
-	0x9a8000 | PTE_P | PTE_W,
-	0x9a9000 | PTE_P | PTE_W,
-	0x9aa000 | PTE_P | PTE_W,
-	0x9ab000 | PTE_P | PTE_W,
-	0x9ac000 | PTE_P | PTE_W,
-	0x9ad000 | PTE_P | PTE_W,
-	0x9ae000 | PTE_P | PTE_W,
-	0x9af000 | PTE_P | PTE_W,
-	0x9b0000 | PTE_P | PTE_W,
-	0x9b1000 | PTE_P | PTE_W,
-	0x9b2000 | PTE_P | PTE_W,
-	0x9b3000 | PTE_P | PTE_W,
-	0x9b4000 | PTE_P | PTE_W,
-	0x9b5000 | PTE_P | PTE_W,
-	0x9b6000 | PTE_P | PTE_W,
-	0x9b7000 | PTE_P | PTE_W,
-	0x9b8000 | PTE_P | PTE_W,
-	0x9b9000 | PTE_P | PTE_W,
-	0x9ba000 | PTE_P | PTE_W,
-	0x9bb000 | PTE_P | PTE_W,
-	0x9bc000 | PTE_P | PTE_W,
-	0x9bd000 | PTE_P | PTE_W,
-	0x9be000 | PTE_P | PTE_W,
-	0x9bf000 | PTE_P | PTE_W,
-	0x9c0000 | PTE_P | PTE_W,
-	0x9c1000 | PTE_P | PTE_W,
-	0x9c2000 | PTE_P | PTE_W,
-	0x9c3000 | PTE_P | PTE_W,
-	0x9c4000 | PTE_P | PTE_W,
-	0x9c5000 | PTE_P | PTE_W,
-	0x9c6000 | PTE_P | PTE_W,
-	0x9c7000 | PTE_P | PTE_W,
-	0x9c8000 | PTE_P | PTE_W,
-	0x9c9000 | PTE_P | PTE_W,
-	0x9ca000 | PTE_P | PTE_W,
-	0x9cb000 | PTE_P | PTE_W,
-	0x9cc000 | PTE_P | PTE_W,
-	0x9cd000 | PTE_P | PTE_W,
-	0x9ce000 | PTE_P | PTE_W,
-	0x9cf000 | PTE_P | PTE_W,
-	0x9d0000 | PTE_P | PTE_W,
-	0x9d1000 | PTE_P | PTE_W,
-	0x9d2000 | PTE_P | PTE_W,
-	0x9d3000 | PTE_P | PTE_W,
-	0x9d4000 | PTE_P | PTE_W,
-	0x9d5000 | PTE_P | PTE_W,
-	0x9d6000 | PTE_P | PTE_W,
-	0x9d7000 | PTE_P | PTE_W,
-	0x9d8000 | PTE_P | PTE_W,
-	0x9d9000 | PTE_P | PTE_W,
-	0x9da000 | PTE_P | PTE_W,
-	0x9db000 | PTE_P | PTE_W,
-	0x9dc000 | PTE_P | PTE_W,
-	0x9dd000 | PTE_P | PTE_W,
-	0x9de000 | PTE_P | PTE_W,
-	0x9df000 | PTE_P | PTE_W,
-	0x9e0000 | PTE_P | PTE_W,
-	0x9e1000 | PTE_P | PTE_W,
-	0x9e2000 | PTE_P | PTE_W,
-	0x9e3000 | PTE_P | PTE_W,
-	0x9e4000 | PTE_P | PTE_W,
-	0x9e5000 | PTE_P | PTE_W,
-	0x9e6000 | PTE_P | PTE_W,
-	0x9e7000 | PTE_P | PTE_W,
-	0x9e8000 | PTE_P | PTE_W,
-	0x9e9000 | PTE_P | PTE_W,
-	0x9ea000 | PTE_P | PTE_W,
-	0x9eb000 | PTE_P | PTE_W,
-	0x9ec000 | PTE_P | PTE_W,
-	0x9ed000 | PTE_P | PTE_W,
-	0x9ee000 | PTE_P | PTE_W,
-	0x9ef000 | PTE_P | PTE_W,
-	0x9f0000 | PTE_P | PTE_W,
-	0x9f1000 | PTE_P | PTE_W,
-	0x9f2000 | PTE_P | PTE_W,
-	0x9f3000 | PTE_P | PTE_W,
-	0x9f4000 | PTE_P | PTE_W,
-	0x9f5000 | PTE_P | PTE_W,
-	0x9f6000 | PTE_P | PTE_W,
-	0x9f7000 | PTE_P | PTE_W,
-	0x9f8000 | PTE_P | PTE_W,
-	0x9f9000 | PTE_P | PTE_W,
-	0x9fa000 | PTE_P | PTE_W,
-	0x9fb000 | PTE_P | PTE_W,
-	0x9fc000 | PTE_P | PTE_W,
-	0x9fd000 | PTE_P | PTE_W,
-	0x9fe000 | PTE_P | PTE_W,
-	0x9ff000 | PTE_P | PTE_W,
-	0xa00000 | PTE_P | PTE_W,
-	0xa01000 | PTE_P | PTE_W,
-	0xa02000 | PTE_P | PTE_W,
-	0xa03000 | PTE_P | PTE_W,
-	0xa04000 | PTE_P | PTE_W,
-	0xa05000 | PTE_P | PTE_W,
-	0xa06000 | PTE_P | PTE_W,
-	0xa07000 | PTE_P | PTE_W,
-	0xa08000 | PTE_P | PTE_W,
-	0xa09000 | PTE_P | PTE_W,
-	0xa0a000 | PTE_P | PTE_W,
-	0xa0b000 | PTE_P | PTE_W,
-	0xa0c000 | PTE_P | PTE_W,
-	0xa0d000 | PTE_P | PTE_W,
-	0xa0e000 | PTE_P | PTE_W,
-	0xa0f000 | PTE_P | PTE_W,
-	0xa10000 | PTE_P | PTE_W,
-	0xa11000 | PTE_P | PTE_W,
-	0xa12000 | PTE_P | PTE_W,
-	0xa13000 | PTE_P | PTE_W,
-	0xa14000 | PTE_P | PTE_W,
-	0xa15000 | PTE_P | PTE_W,
-	0xa16000 | PTE_P | PTE_W,
-	0xa17000 | PTE_P | PTE_W,
-	0xa18000 | PTE_P | PTE_W,
-	0xa19000 | PTE_P | PTE_W,
-	0xa1a000 | PTE_P | PTE_W,
-	0xa1b000 | PTE_P | PTE_W,
-	0xa1c000 | PTE_P | PTE_W,
-	0xa1d000 | PTE_P | PTE_W,
-	0xa1e000 | PTE_P | PTE_W,
-	0xa1f000 | PTE_P | PTE_W,
-	0xa20000 | PTE_P | PTE_W,
-	0xa21000 | PTE_P | PTE_W,
-	0xa22000 | PTE_P | PTE_W,
-	0xa23000 | PTE_P | PTE_W,
-	0xa24000 | PTE_P | PTE_W,
-	0xa25000 | PTE_P | PTE_W,
-	0xa26000 | PTE_P | PTE_W,
-	0xa27000 | PTE_P | PTE_W,
-	0xa28000 | PTE_P | PTE_W,
-	0xa29000 | PTE_P | PTE_W,
-	0xa2a000 | PTE_P | PTE_W,
-	0xa2b000 | PTE_P | PTE_W,
-	0xa2c000 | PTE_P | PTE_W,
-	0xa2d000 | PTE_P | PTE_W,
-	0xa2e000 | PTE_P | PTE_W,
-	0xa2f000 | PTE_P | PTE_W,
-	0xa30000 | PTE_P | PTE_W,
-	0xa31000 | PTE_P | PTE_W,
-	0xa32000 | PTE_P | PTE_W,
-	0xa33000 | PTE_P | PTE_W,
-	0xa34000 | PTE_P | PTE_W,
-	0xa35000 | PTE_P | PTE_W,
-	0xa36000 | PTE_P | PTE_W,
-	0xa37000 | PTE_P | PTE_W,
-	0xa38000 | PTE_P | PTE_W,
-	0xa39000 | PTE_P | PTE_W,
-	0xa3a000 | PTE_P | PTE_W,
-	0xa3b000 | PTE_P | PTE_W,
-	0xa3c000 | PTE_P | PTE_W,
-	0xa3d000 | PTE_P | PTE_W,
-	0xa3e000 | PTE_P | PTE_W,
-	0xa3f000 | PTE_P | PTE_W,
-	0xa40000 | PTE_P | PTE_W,
-	0xa41000 | PTE_P | PTE_W,
-	0xa42000 | PTE_P | PTE_W,
-	0xa43000 | PTE_P | PTE_W,
-	0xa44000 | PTE_P | PTE_W,
-	0xa45000 | PTE_P | PTE_W,
-	0xa46000 | PTE_P | PTE_W,
-	0xa47000 | PTE_P | PTE_W,
-	0xa48000 | PTE_P | PTE_W,
-	0xa49000 | PTE_P | PTE_W,
-	0xa4a000 | PTE_P | PTE_W,
-	0xa4b000 | PTE_P | PTE_W,
-	0xa4c000 | PTE_P | PTE_W,
-	0xa4d000 | PTE_P | PTE_W,
-	0xa4e000 | PTE_P | PTE_W,
-	0xa4f000 | PTE_P | PTE_W,
-	0xa50000 | PTE_P | PTE_W,
-	0xa51000 | PTE_P | PTE_W,
-	0xa52000 | PTE_P | PTE_W,
-	0xa53000 | PTE_P | PTE_W,
-	0xa54000 | PTE_P | PTE_W,
-	0xa55000 | PTE_P | PTE_W,
-	0xa56000 | PTE_P | PTE_W,
-	0xa57000 | PTE_P | PTE_W,
-	0xa58000 | PTE_P | PTE_W,
-	0xa59000 | PTE_P | PTE_W,
-	0xa5a000 | PTE_P | PTE_W,
-	0xa5b000 | PTE_P | PTE_W,
-	0xa5c000 | PTE_P | PTE_W,
-	0xa5d000 | PTE_P | PTE_W,
-	0xa5e000 | PTE_P | PTE_W,
-	0xa5f000 | PTE_P | PTE_W,
-	0xa60000 | PTE_P | PTE_W,
-	0xa61000 | PTE_P | PTE_W,
-	0xa62000 | PTE_P | PTE_W,
-	0xa63000 | PTE_P | PTE_W,
-	0xa64000 | PTE_P | PTE_W,
-	0xa65000 | PTE_P | PTE_W,
-	0xa66000 | PTE_P | PTE_W,
-	0xa67000 | PTE_P | PTE_W,
-	0xa68000 | PTE_P | PTE_W,
-	0xa69000 | PTE_P | PTE_W,
-	0xa6a000 | PTE_P | PTE_W,
-	0xa6b000 | PTE_P | PTE_W,
-	0xa6c000 | PTE_P | PTE_W,
-	0xa6d000 | PTE_P | PTE_W,
-	0xa6e000 | PTE_P | PTE_W,
-	0xa6f000 | PTE_P | PTE_W,
-	0xa70000 | PTE_P | PTE_W,
-	0xa71000 | PTE_P | PTE_W,
-	0xa72000 | PTE_P | PTE_W,
-	0xa73000 | PTE_P | PTE_W,
-	0xa74000 | PTE_P | PTE_W,
-	0xa75000 | PTE_P | PTE_W,
-	0xa76000 | PTE_P | PTE_W,
-	0xa77000 | PTE_P | PTE_W,
-	0xa78000 | PTE_P | PTE_W,
-	0xa79000 | PTE_P | PTE_W,
-	0xa7a000 | PTE_P | PTE_W,
-	0xa7b000 | PTE_P | PTE_W,
-	0xa7c000 | PTE_P | PTE_W,
-	0xa7d000 | PTE_P | PTE_W,
-	0xa7e000 | PTE_P | PTE_W,
-	0xa7f000 | PTE_P | PTE_W,
-	0xa80000 | PTE_P | PTE_W,
-	0xa81000 | PTE_P | PTE_W,
-	0xa82000 | PTE_P | PTE_W,
-	0xa83000 | PTE_P | PTE_W,
-	0xa84000 | PTE_P | PTE_W,
-	0xa85000 | PTE_P | PTE_W,
-	0xa86000 | PTE_P | PTE_W,
-	0xa87000 | PTE_P | PTE_W,
-	0xa88000 | PTE_P | PTE_W,
-	0xa89000 | PTE_P | PTE_W,
-	0xa8a000 | PTE_P | PTE_W,
-	0xa8b000 | PTE_P | PTE_W,
-	0xa8c000 | PTE_P | PTE_W,
-	0xa8d000 | PTE_P | PTE_W,
-	0xa8e000 | PTE_P | PTE_W,
-	0xa8f000 | PTE_P | PTE_W,
-	0xa90000 | PTE_P | PTE_W,
-	0xa91000 | PTE_P | PTE_W,
-	0xa92000 | PTE_P | PTE_W,
-	0xa93000 | PTE_P | PTE_W,
-	0xa94000 | PTE_P | PTE_W,
-	0xa95000 | PTE_P | PTE_W,
-	0xa96000 | PTE_P | PTE_W,
-	0xa97000 | PTE_P | PTE_W,
-	0xa98000 | PTE_P | PTE_W,
-	0xa99000 | PTE_P | PTE_W,
-	0xa9a000 | PTE_P | PTE_W,
-	0xa9b000 | PTE_P | PTE_W,
-	0xa9c000 | PTE_P | PTE_W,
-	0xa9d000 | PTE_P | PTE_W,
-	0xa9e000 | PTE_P | PTE_W,
-	0xa9f000 | PTE_P | PTE_W,
-	0xaa0000 | PTE_P | PTE_W,
-	0xaa1000 | PTE_P | PTE_W,
-	0xaa2000 | PTE_P | PTE_W,
-	0xaa3000 | PTE_P | PTE_W,
-	0xaa4000 | PTE_P | PTE_W,
-	0xaa5000 | PTE_P | PTE_W,
-	0xaa6000 | PTE_P | PTE_W,
-	0xaa7000 | PTE_P | PTE_W,
-	0xaa8000 | PTE_P | PTE_W,
-	0xaa9000 | PTE_P | PTE_W,
-	0xaaa000 | PTE_P | PTE_W,
-	0xaab000 | PTE_P | PTE_W,
-	0xaac000 | PTE_P | PTE_W,
-	0xaad000 | PTE_P | PTE_W,
-	0xaae000 | PTE_P | PTE_W,
-	0xaaf000 | PTE_P | PTE_W,
-	0xab0000 | PTE_P | PTE_W,
-	0xab1000 | PTE_P | PTE_W,
-	0xab2000 | PTE_P | PTE_W,
-	0xab3000 | PTE_P | PTE_W,
-	0xab4000 | PTE_P | PTE_W,
-	0xab5000 | PTE_P | PTE_W,
-	0xab6000 | PTE_P | PTE_W,
-	0xab7000 | PTE_P | PTE_W,
-	0xab8000 | PTE_P | PTE_W,
-	0xab9000 | PTE_P | PTE_W,
-	0xaba000 | PTE_P | PTE_W,
-	0xabb000 | PTE_P | PTE_W,
-	0xabc000 | PTE_P | PTE_W,
-	0xabd000 | PTE_P | PTE_W,
-	0xabe000 | PTE_P | PTE_W,
-	0xabf000 | PTE_P | PTE_W,
-	0xac0000 | PTE_P | PTE_W,
-	0xac1000 | PTE_P | PTE_W,
-	0xac2000 | PTE_P | PTE_W,
-	0xac3000 | PTE_P | PTE_W,
-	0xac4000 | PTE_P | PTE_W,
-	0xac5000 | PTE_P | PTE_W,
-	0xac6000 | PTE_P | PTE_W,
-	0xac7000 | PTE_P | PTE_W,
-	0xac8000 | PTE_P | PTE_W,
-	0xac9000 | PTE_P | PTE_W,
-	0xaca000 | PTE_P | PTE_W,
-	0xacb000 | PTE_P | PTE_W,
-	0xacc000 | PTE_P | PTE_W,
-	0xacd000 | PTE_P | PTE_W,
-	0xace000 | PTE_P | PTE_W,
-	0xacf000 | PTE_P | PTE_W,
-	0xad0000 | PTE_P | PTE_W,
-	0xad1000 | PTE_P | PTE_W,
-	0xad2000 | PTE_P | PTE_W,
-	0xad3000 | PTE_P | PTE_W,
-	0xad4000 | PTE_P | PTE_W,
-	0xad5000 | PTE_P | PTE_W,
-	0xad6000 | PTE_P | PTE_W,
-	0xad7000 | PTE_P | PTE_W,
-	0xad8000 | PTE_P | PTE_W,
-	0xad9000 | PTE_P | PTE_W,
-	0xada000 | PTE_P | PTE_W,
-	0xadb000 | PTE_P | PTE_W,
-	0xadc000 | PTE_P | PTE_W,
-	0xadd000 | PTE_P | PTE_W,
-	0xade000 | PTE_P | PTE_W,
-	0xadf000 | PTE_P | PTE_W,
-	0xae0000 | PTE_P | PTE_W,
-	0xae1000 | PTE_P | PTE_W,
-	0xae2000 | PTE_P | PTE_W,
-	0xae3000 | PTE_P | PTE_W,
-	0xae4000 | PTE_P | PTE_W,
-	0xae5000 | PTE_P | PTE_W,
-	0xae6000 | PTE_P | PTE_W,
-	0xae7000 | PTE_P | PTE_W,
-	0xae8000 | PTE_P | PTE_W,
-	0xae9000 | PTE_P | PTE_W,
-	0xaea000 | PTE_P | PTE_W,
-	0xaeb000 | PTE_P | PTE_W,
-	0xaec000 | PTE_P | PTE_W,
-	0xaed000 | PTE_P | PTE_W,
-	0xaee000 | PTE_P | PTE_W,
-	0xaef000 | PTE_P | PTE_W,
-	0xaf0000 | PTE_P | PTE_W,
-	0xaf1000 | PTE_P | PTE_W,
-	0xaf2000 | PTE_P | PTE_W,
-	0xaf3000 | PTE_P | PTE_W,
-	0xaf4000 | PTE_P | PTE_W,
-	0xaf5000 | PTE_P | PTE_W,
-	0xaf6000 | PTE_P | PTE_W,
-	0xaf7000 | PTE_P | PTE_W,
-	0xaf8000 | PTE_P | PTE_W,
-	0xaf9000 | PTE_P | PTE_W,
-	0xafa000 | PTE_P | PTE_W,
-	0xafb000 | PTE_P | PTE_W,
-	0xafc000 | PTE_P | PTE_W,
-	0xafd000 | PTE_P | PTE_W,
-	0xafe000 | PTE_P | PTE_W,
-	0xaff000 | PTE_P | PTE_W,
-	0xb00000 | PTE_P | PTE_W,
-	0xb01000 | PTE_P | PTE_W,
-	0xb02000 | PTE_P | PTE_W,
-	0xb03000 | PTE_P | PTE_W,
-	0xb04000 | PTE_P | PTE_W,
-	0xb05000 | PTE_P | PTE_W,
-	0xb06000 | PTE_P | PTE_W,
-	0xb07000 | PTE_P | PTE_W,
-	0xb08000 | PTE_P | PTE_W,
-	0xb09000 | PTE_P | PTE_W,
-	0xb0a000 | PTE_P | PTE_W,
-	0xb0b000 | PTE_P | PTE_W,
-	0xb0c000 | PTE_P | PTE_W,
-	0xb0d000 | PTE_P | PTE_W,
-	0xb0e000 | PTE_P | PTE_W,
-	0xb0f000 | PTE_P | PTE_W,
-	0xb10000 | PTE_P | PTE_W,
-	0xb11000 | PTE_P | PTE_W,
-	0xb12000 | PTE_P | PTE_W,
-	0xb13000 | PTE_P | PTE_W,
-	0xb14000 | PTE_P | PTE_W,
-	0xb15000 | PTE_P | PTE_W,
-	0xb16000 | PTE_P | PTE_W,
-	0xb17000 | PTE_P | PTE_W,
-	0xb18000 | PTE_P | PTE_W,
-	0xb19000 | PTE_P | PTE_W,
-	0xb1a000 | PTE_P | PTE_W,
-	0xb1b000 | PTE_P | PTE_W,
-	0xb1c000 | PTE_P | PTE_W,
-	0xb1d000 | PTE_P | PTE_W,
-	0xb1e000 | PTE_P | PTE_W,
-	0xb1f000 | PTE_P | PTE_W,
-	0xb20000 | PTE_P | PTE_W,
-	0xb21000 | PTE_P | PTE_W,
-	0xb22000 | PTE_P | PTE_W,
-	0xb23000 | PTE_P | PTE_W,
-	0xb24000 | PTE_P | PTE_W,
-	0xb25000 | PTE_P | PTE_W,
-	0xb26000 | PTE_P | PTE_W,
-	0xb27000 | PTE_P | PTE_W,
-	0xb28000 | PTE_P | PTE_W,
-	0xb29000 | PTE_P | PTE_W,
-	0xb2a000 | PTE_P | PTE_W,
-	0xb2b000 | PTE_P | PTE_W,
-	0xb2c000 | PTE_P | PTE_W,
-	0xb2d000 | PTE_P | PTE_W,
-	0xb2e000 | PTE_P | PTE_W,
-	0xb2f000 | PTE_P | PTE_W,
-	0xb30000 | PTE_P | PTE_W,
-	0xb31000 | PTE_P | PTE_W,
-	0xb32000 | PTE_P | PTE_W,
-	0xb33000 | PTE_P | PTE_W,
-	0xb34000 | PTE_P | PTE_W,
-	0xb35000 | PTE_P | PTE_W,
-	0xb36000 | PTE_P | PTE_W,
-	0xb37000 | PTE_P | PTE_W,
-	0xb38000 | PTE_P | PTE_W,
-	0xb39000 | PTE_P | PTE_W,
-	0xb3a000 | PTE_P | PTE_W,
-	0xb3b000 | PTE_P | PTE_W,
-	0xb3c000 | PTE_P | PTE_W,
-	0xb3d000 | PTE_P | PTE_W,
-	0xb3e000 | PTE_P | PTE_W,
-	0xb3f000 | PTE_P | PTE_W,
-	0xb40000 | PTE_P | PTE_W,
-	0xb41000 | PTE_P | PTE_W,
-	0xb42000 | PTE_P | PTE_W,
-	0xb43000 | PTE_P | PTE_W,
-	0xb44000 | PTE_P | PTE_W,
-	0xb45000 | PTE_P | PTE_W,
-	0xb46000 | PTE_P | PTE_W,
-	0xb47000 | PTE_P | PTE_W,
-	0xb48000 | PTE_P | PTE_W,
-	0xb49000 | PTE_P | PTE_W,
-	0xb4a000 | PTE_P | PTE_W,
-	0xb4b000 | PTE_P | PTE_W,
-	0xb4c000 | PTE_P | PTE_W,
-	0xb4d000 | PTE_P | PTE_W,
-	0xb4e000 | PTE_P | PTE_W,
-	0xb4f000 | PTE_P | PTE_W,
-	0xb50000 | PTE_P | PTE_W,
-	0xb51000 | PTE_P | PTE_W,
-	0xb52000 | PTE_P | PTE_W,
-	0xb53000 | PTE_P | PTE_W,
-	0xb54000 | PTE_P | PTE_W,
-	0xb55000 | PTE_P | PTE_W,
-	0xb56000 | PTE_P | PTE_W,
-	0xb57000 | PTE_P | PTE_W,
-	0xb58000 | PTE_P | PTE_W,
-	0xb59000 | PTE_P | PTE_W,
-	0xb5a000 | PTE_P | PTE_W,
-	0xb5b000 | PTE_P | PTE_W,
-	0xb5c000 | PTE_P | PTE_W,
-	0xb5d000 | PTE_P | PTE_W,
-	0xb5e000 | PTE_P | PTE_W,
-	0xb5f000 | PTE_P | PTE_W,
-	0xb60000 | PTE_P | PTE_W,
-	0xb61000 | PTE_P | PTE_W,
-	0xb62000 | PTE_P | PTE_W,
-	0xb63000 | PTE_P | PTE_W,
-	0xb64000 | PTE_P | PTE_W,
-	0xb65000 | PTE_P | PTE_W,
-	0xb66000 | PTE_P | PTE_W,
-	0xb67000 | PTE_P | PTE_W,
-	0xb68000 | PTE_P | PTE_W,
-	0xb69000 | PTE_P | PTE_W,
-	0xb6a000 | PTE_P | PTE_W,
-	0xb6b000 | PTE_P | PTE_W,
-	0xb6c000 | PTE_P | PTE_W,
-	0xb6d000 | PTE_P | PTE_W,
-	0xb6e000 | PTE_P | PTE_W,
-	0xb6f000 | PTE_P | PTE_W,
-	0xb70000 | PTE_P | PTE_W,
-	0xb71000 | PTE_P | PTE_W,
-	0xb72000 | PTE_P | PTE_W,
-	0xb73000 | PTE_P | PTE_W,
-	0xb74000 | PTE_P | PTE_W,
-	0xb75000 | PTE_P | PTE_W,
-	0xb76000 | PTE_P | PTE_W,
-	0xb77000 | PTE_P | PTE_W,
-	0xb78000 | PTE_P | PTE_W,
-	0xb79000 | PTE_P | PTE_W,
-	0xb7a000 | PTE_P | PTE_W,
-	0xb7b000 | PTE_P | PTE_W,
-	0xb7c000 | PTE_P | PTE_W,
-	0xb7d000 | PTE_P | PTE_W,
-	0xb7e000 | PTE_P | PTE_W,
-	0xb7f000 | PTE_P | PTE_W,
-	0xb80000 | PTE_P | PTE_W,
-	0xb81000 | PTE_P | PTE_W,
-	0xb82000 | PTE_P | PTE_W,
-	0xb83000 | PTE_P | PTE_W,
-	0xb84000 | PTE_P | PTE_W,
-	0xb85000 | PTE_P | PTE_W,
-	0xb86000 | PTE_P | PTE_W,
-	0xb87000 | PTE_P | PTE_W,
-	0xb88000 | PTE_P | PTE_W,
-	0xb89000 | PTE_P | PTE_W,
-	0xb8a000 | PTE_P | PTE_W,
-	0xb8b000 | PTE_P | PTE_W,
-	0xb8c000 | PTE_P | PTE_W,
-	0xb8d000 | PTE_P | PTE_W,
-	0xb8e000 | PTE_P | PTE_W,
-	0xb8f000 | PTE_P | PTE_W,
-	0xb90000 | PTE_P | PTE_W,
-	0xb91000 | PTE_P | PTE_W,
-	0xb92000 | PTE_P | PTE_W,
-	0xb93000 | PTE_P | PTE_W,
-	0xb94000 | PTE_P | PTE_W,
-	0xb95000 | PTE_P | PTE_W,
-	0xb96000 | PTE_P | PTE_W,
-	0xb97000 | PTE_P | PTE_W,
-	0xb98000 | PTE_P | PTE_W,
-	0xb99000 | PTE_P | PTE_W,
-	0xb9a000 | PTE_P | PTE_W,
-	0xb9b000 | PTE_P | PTE_W,
-	0xb9c000 | PTE_P | PTE_W,
-	0xb9d000 | PTE_P | PTE_W,
-	0xb9e000 | PTE_P | PTE_W,
-	0xb9f000 | PTE_P | PTE_W,
-	0xba0000 | PTE_P | PTE_W,
-	0xba1000 | PTE_P | PTE_W,
-	0xba2000 | PTE_P | PTE_W,
-	0xba3000 | PTE_P | PTE_W,
-	0xba4000 | PTE_P | PTE_W,
-	0xba5000 | PTE_P | PTE_W,
-	0xba6000 | PTE_P | PTE_W,
-	0xba7000 | PTE_P | PTE_W,
-	0xba8000 | PTE_P | PTE_W,
-	0xba9000 | PTE_P | PTE_W,
-	0xbaa000 | PTE_P | PTE_W,
-	0xbab000 | PTE_P | PTE_W,
-	0xbac000 | PTE_P | PTE_W,
-	0xbad000 | PTE_P | PTE_W,
-	0xbae000 | PTE_P | PTE_W,
-	0xbaf000 | PTE_P | PTE_W,
-	0xbb0000 | PTE_P | PTE_W,
-	0xbb1000 | PTE_P | PTE_W,
-	0xbb2000 | PTE_P | PTE_W,
-	0xbb3000 | PTE_P | PTE_W,
-	0xbb4000 | PTE_P | PTE_W,
-	0xbb5000 | PTE_P | PTE_W,
-	0xbb6000 | PTE_P | PTE_W,
-	0xbb7000 | PTE_P | PTE_W,
-	0xbb8000 | PTE_P | PTE_W,
-	0xbb9000 | PTE_P | PTE_W,
-	0xbba000 | PTE_P | PTE_W,
-	0xbbb000 | PTE_P | PTE_W,
-	0xbbc000 | PTE_P | PTE_W,
-	0xbbd000 | PTE_P | PTE_W,
-	0xbbe000 | PTE_P | PTE_W,
-	0xbbf000 | PTE_P | PTE_W,
-	0xbc0000 | PTE_P | PTE_W,
-	0xbc1000 | PTE_P | PTE_W,
-	0xbc2000 | PTE_P | PTE_W,
-	0xbc3000 | PTE_P | PTE_W,
-	0xbc4000 | PTE_P | PTE_W,
-	0xbc5000 | PTE_P | PTE_W,
-	0xbc6000 | PTE_P | PTE_W,
-	0xbc7000 | PTE_P | PTE_W,
-	0xbc8000 | PTE_P | PTE_W,
-	0xbc9000 | PTE_P | PTE_W,
-	0xbca000 | PTE_P | PTE_W,
-	0xbcb000 | PTE_P | PTE_W,
-	0xbcc000 | PTE_P | PTE_W,
-	0xbcd000 | PTE_P | PTE_W,
-	0xbce000 | PTE_P | PTE_W,
-	0xbcf000 | PTE_P | PTE_W,
-	0xbd0000 | PTE_P | PTE_W,
-	0xbd1000 | PTE_P | PTE_W,
-	0xbd2000 | PTE_P | PTE_W,
-	0xbd3000 | PTE_P | PTE_W,
-	0xbd4000 | PTE_P | PTE_W,
-	0xbd5000 | PTE_P | PTE_W,
-	0xbd6000 | PTE_P | PTE_W,
-	0xbd7000 | PTE_P | PTE_W,
-	0xbd8000 | PTE_P | PTE_W,
-	0xbd9000 | PTE_P | PTE_W,
-	0xbda000 | PTE_P | PTE_W,
-	0xbdb000 | PTE_P | PTE_W,
-	0xbdc000 | PTE_P | PTE_W,
-	0xbdd000 | PTE_P | PTE_W,
-	0xbde000 | PTE_P | PTE_W,
-	0xbdf000 | PTE_P | PTE_W,
-	0xbe0000 | PTE_P | PTE_W,
-	0xbe1000 | PTE_P | PTE_W,
-	0xbe2000 | PTE_P | PTE_W,
-	0xbe3000 | PTE_P | PTE_W,
-	0xbe4000 | PTE_P | PTE_W,
-	0xbe5000 | PTE_P | PTE_W,
-	0xbe6000 | PTE_P | PTE_W,
-	0xbe7000 | PTE_P | PTE_W,
-	0xbe8000 | PTE_P | PTE_W,
-	0xbe9000 | PTE_P | PTE_W,
-	0xbea000 | PTE_P | PTE_W,
-	0xbeb000 | PTE_P | PTE_W,
-	0xbec000 | PTE_P | PTE_W,
-	0xbed000 | PTE_P | PTE_W,
-	0xbee000 | PTE_P | PTE_W,
-	0xbef000 | PTE_P | PTE_W,
-	0xbf0000 | PTE_P | PTE_W,
-	0xbf1000 | PTE_P | PTE_W,
-	0xbf2000 | PTE_P | PTE_W,
-	0xbf3000 | PTE_P | PTE_W,
-	0xbf4000 | PTE_P | PTE_W,
-	0xbf5000 | PTE_P | PTE_W,
-	0xbf6000 | PTE_P | PTE_W,
-	0xbf7000 | PTE_P | PTE_W,
-	0xbf8000 | PTE_P | PTE_W,
-	0xbf9000 | PTE_P | PTE_W,
-	0xbfa000 | PTE_P | PTE_W,
-	0xbfb000 | PTE_P | PTE_W,
-	0xbfc000 | PTE_P | PTE_W,
-	0xbfd000 | PTE_P | PTE_W,
-	0xbfe000 | PTE_P | PTE_W,
-	0xbff000 | PTE_P | PTE_W,
-};
-
 #ifdef SANITIZE_SHADOW_BASE
 // 12 MB of sanitize pagetable in 4 MB blocks
 __attribute__((__aligned__(PGSIZE)))
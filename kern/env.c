@@ -6,25 +6,31 @@
 #include <inc/string.h>
 #include <inc/assert.h>
 #include <inc/elf.h>
+#include <inc/vsyscall.h>
 
 #include <kern/env.h>
 #include <kern/pmap.h>
 #include <kern/trap.h>
 #include <kern/monitor.h>
 #include <kern/sched.h>
+#include <kern/syscall.h>
 #include <kern/cpu.h>
 #include <kern/kdebug.h>
+#include <kern/spinlock.h>
+#include <kern/vsyscall.h>
 
 #ifdef CONFIG_KSPACE
 struct Env env_array[NENV];
-struct Env *curenv = NULL;
 struct Env *envs = env_array;		// All environments
 #else
 struct Env *envs = NULL;		// All environments
-struct Env *curenv = NULL;		// The current env
 #endif
 static struct Env *env_free_list;	// Free environment list
 					// (linked by Env->env_link)
+static struct spinlock env_table_lock;	// Protects env_free_list
+
+// One lock per env, indexed like envs[].  See env_lock().
+static struct spinlock env_locks[NENV];
 
 #define ENVGENSHIFT	12		// >= LOGNENV
 
@@ -117,6 +123,105 @@ envid2env(envid_t envid, struct Env **env_store, bool checkperm)
 	return 0;
 }
 
+//
+// Lock e's address space and IPC state against other CPUs.
+// The lock belongs to the envs[] slot, so it is safe to take even if
+// e is freed and reused meanwhile; callers that looked e up by id
+// must then check that it is still the env they wanted, as
+// envid2env_lock does.
+//
+void
+env_lock(struct Env *e)
+{
+	spin_lock(&env_locks[e - envs]);
+}
+
+void
+env_unlock(struct Env *e)
+{
+	spin_unlock(&env_locks[e - envs]);
+}
+
+// Lock two envs, which may be the same one, in the documented order.
+void
+env_lock_pair(struct Env *a, struct Env *b)
+{
+	if (a > b) {
+		struct Env *t = a;
+		a = b;
+		b = t;
+	}
+	env_lock(a);
+	if (b != a)
+		env_lock(b);
+}
+
+void
+env_unlock_pair(struct Env *a, struct Env *b)
+{
+	if (b != a)
+		env_unlock(b);
+	env_unlock(a);
+}
+
+//
+// Like envid2env, but also takes the env's lock, for system calls
+// that run without the big kernel lock.  Once the lock is held, the
+// env can no longer be freed under the caller.
+//
+// RETURNS
+//   0 on success, -E_BAD_ENV on error, with the lock not held.
+//
+int
+envid2env_lock(envid_t envid, struct Env **env_store, bool checkperm)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, checkperm)) < 0) {
+		*env_store = NULL;
+		return r;
+	}
+	env_lock(e);
+	// env_free tears the address space down under the lock,
+	// and envid 0 (curenv) cannot be freed while it runs here.
+	if (e->env_status == ENV_FREE || !e->env_pgdir ||
+	    (envid != 0 && e->env_id != envid)) {
+		env_unlock(e);
+		*env_store = NULL;
+		return -E_BAD_ENV;
+	}
+	*env_store = e;
+	return 0;
+}
+
+//
+// Like envid2env_lock, for two envs at once, which may be the same one.
+//
+int
+envid2env_lock_pair(envid_t aid, struct Env **a_store,
+		    envid_t bid, struct Env **b_store, bool checkperm)
+{
+	struct Env *a, *b;
+	int r;
+
+	*a_store = *b_store = NULL;
+	if ((r = envid2env(aid, &a, checkperm)) < 0 ||
+	    (r = envid2env(bid, &b, checkperm)) < 0)
+		return r;
+	env_lock_pair(a, b);
+	if (a->env_status == ENV_FREE || !a->env_pgdir ||
+	    (aid != 0 && a->env_id != aid) ||
+	    b->env_status == ENV_FREE || !b->env_pgdir ||
+	    (bid != 0 && b->env_id != bid)) {
+		env_unlock_pair(a, b);
+		return -E_BAD_ENV;
+	}
+	*a_store = a;
+	*b_store = b;
+	return 0;
+}
+
 // Mark all environments in 'envs' as free, set their env_ids to 0,
 // and insert them into the env_free_list.
 // Make sure the environments are in the free list in the same order
@@ -126,6 +231,10 @@ envid2env(envid_t envid, struct Env **env_store, bool checkperm)
 void
 env_init(void)
 {
+	spin_initlock(&env_table_lock);
+	for (int i = 0; i < NENV; i++)
+		__spin_initlock(&env_locks[i], "env_lock");
+
 	// Set up envs array
 	env_free_list = &envs[0];
 	for (int i=0; i < NENV; i++) {
@@ -244,16 +353,25 @@ int
 env_alloc(struct Env **newenv_store, envid_t parent_id)
 {
 	int32_t generation;
-	struct Env *e = env_free_list;
+	struct Env *e;
 	int r;
 
-	if (! e) {
+	spin_lock(&env_table_lock);
+	if (! (e = env_free_list)) {
+		spin_unlock(&env_table_lock);
 		return -E_NO_FREE_ENV;
 	}
+	env_free_list = e->env_link;
+	spin_unlock(&env_table_lock);
 
 	// Allocate and set up the page directory for this environment.
-	if ((r = env_setup_vm(e)) < 0)
+	if ((r = env_setup_vm(e)) < 0) {
+		spin_lock(&env_table_lock);
+		e->env_link = env_free_list;
+		env_free_list = e;
+		spin_unlock(&env_table_lock);
 		return r;
+	}
 
 	// Generate an env_id for this environment.
 	generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
@@ -268,8 +386,11 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 #else
 	e->env_type = ENV_TYPE_USER;
 #endif
-	e->env_status = ENV_RUNNABLE;
 	e->env_runs = 0;
+	e->env_priority = ENV_PRIO_DEFAULT;
+	e->env_vruntime = 0;
+	e->env_cputime = 0;
+	sched_set_nice(e, 0);
 
 	// Clear out all the saved register state,
 	// to prevent the register values
@@ -299,6 +420,10 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	extern char end[];
 	if ((char *)expected_addr_lowest < end)
 	{
+		spin_lock(&env_table_lock);
+		e->env_link = env_free_list;
+		env_free_list = e;
+		spin_unlock(&env_table_lock);
 		return -E_NO_MEM;
 	}
 	e->env_tf.tf_esp = expected_addr;
@@ -316,12 +441,16 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 
 	// Clear the page fault handler until user installs one.
 	e->env_pgfault_upcall = 0;
+	e->env_kcow = false;
+	e->env_sysring = NULL;
 
 	// Also clear the IPC receiving flag.
 	e->env_ipc_recving = 0;
 
-	// commit the allocation
-	env_free_list = e->env_link;
+	// commit the allocation.  The env is not runnable yet: other
+	// CPUs could start running it before the caller is done with it.
+	e->env_link = NULL;
+	sched_set_status(e, ENV_NOT_RUNNABLE);
 	*newenv_store = e;
 
 	cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
@@ -483,7 +612,7 @@ load_icode(struct Env *e, uint8_t *binary, size_t size)
 	}
 
 
-	lcr3(PADDR(e->env_pgdir));
+	pgdir_load(e->env_pgdir);
 
 	struct Proghdr *ph = (struct Proghdr *) (binary + elf_header->e_phoff);
 	struct Proghdr *eph = (struct Proghdr *) (ph + elf_header->e_phnum);
@@ -511,7 +640,7 @@ load_icode(struct Env *e, uint8_t *binary, size_t size)
 	region_alloc(e, (void *)(va_stack_addr), USTACKSIZE);
 	memset((void*)(va_stack_addr), 0, USTACKSIZE);
 
-	lcr3(PADDR(kern_pgdir));
+	pgdir_load(kern_pgdir);
 
 	e->env_tf.tf_eip = elf_header->e_entry;
 	// e->env_tf.tf_esp = total_size;
@@ -552,11 +681,24 @@ env_create(uint8_t *binary, size_t size, enum EnvType type)
 	load_icode(newenv, binary, size);
 	newenv->env_type = type;
 
+	// Idle environments only run when nothing else is runnable.
+	if (type == ENV_TYPE_IDLE) {
+		sched_set_priority(newenv, ENV_PRIO_IDLE);
+	}
+
+	// System environments serve everybody else, so they get
+	// a bigger share of the CPU than ordinary user environments.
+	if (type != ENV_TYPE_IDLE && type != ENV_TYPE_USER) {
+		sched_set_nice(newenv, ENV_NICE_SYSTEM);
+	}
+
 	// If this is the file server (type == ENV_TYPE_FS) give it I/O privileges.
 	// LAB 10: Your code here.
 	if (type == ENV_TYPE_FS) {
 		newenv->env_tf.tf_eflags |= FL_IOPL_3;
 	}
+
+	sched_set_status(newenv, ENV_RUNNABLE);
 }
 
 //
@@ -574,13 +716,18 @@ env_free(struct Env *e)
 	// before freeing the page directory, just in case the page
 	// gets reused.
 	if (e == curenv)
-		lcr3(PADDR(kern_pgdir));
+		pgdir_load(kern_pgdir);
 #endif
 
 	// Note the environment's demise.
 	cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 
 #ifndef CONFIG_KSPACE
+	// System calls running on other CPUs without the big kernel lock
+	// may be using this address space; wait for them, and make them
+	// see that it is gone.
+	env_lock(e);
+
 	// Flush all mapped pages in the user portion of the address space
 	static_assert(UTOP % PTSIZE == 0, "Misaligned UTOP");
 	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
@@ -589,14 +736,26 @@ env_free(struct Env *e)
 		if (!(e->env_pgdir[pdeno] & PTE_P))
 			continue;
 
+		// a 4MB page has no page table
+		if (e->env_pgdir[pdeno] & PTE_PS) {
+			assert(page_remove(e->env_pgdir, PGADDR(pdeno, 0, 0)) == 0);
+			continue;
+		}
+
 		// find the pa and va of the page table
 		pa = PTE_ADDR(e->env_pgdir[pdeno]);
 		pt = (pte_t*) KADDR(pa);
 
-		// unmap all PTEs in this page table
+		// a page table still shared with other envs since fork
+		// keeps its pages, just drop our reference to it
+		if (pgdir_drop_shared(e->env_pgdir, pdeno))
+			continue;
+
+		// unmap all PTEs in this page table; we are its last
+		// sharer, so page_remove takes it over without a copy
 		for (pteno = 0; pteno <= PTX(~0); pteno++) {
 			if (pt[pteno] & PTE_P)
-				page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0));
+				assert(page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0)) == 0);
 		}
 
 		// free the page table itself
@@ -607,12 +766,70 @@ env_free(struct Env *e)
 	// free the page directory
 	pa = PADDR(e->env_pgdir);
 	e->env_pgdir = 0;
+	env_unlock(e);
 	page_decref(pa2page(pa));
 #endif
+	// Drop the kernel's own reference to the system call ring.
+	if (e->env_sysring) {
+		page_decref(e->env_sysring);
+		e->env_sysring = NULL;
+	}
+
+	// Drop out of the sender FIFO of the env we are blocked sending to,
+	// and fail the sends of everybody blocked sending to us.
+	if (e->env_ipc_send_to) {
+		struct Env **pp = &e->env_ipc_send_to->env_ipc_senders;
+		struct Env *prev = NULL;
+		while (*pp != e) {
+			prev = *pp;
+			pp = &prev->env_ipc_send_next;
+		}
+		*pp = e->env_ipc_send_next;
+		if (e->env_ipc_send_to->env_ipc_senders_tail == e)
+			e->env_ipc_send_to->env_ipc_senders_tail = prev;
+		e->env_ipc_send_to = NULL;
+		e->env_ipc_send_next = NULL;
+	}
+	while (e->env_ipc_senders) {
+		struct Env *sender = e->env_ipc_senders;
+		e->env_ipc_senders = sender->env_ipc_send_next;
+		sender->env_ipc_send_next = NULL;
+		sender->env_ipc_send_to = NULL;
+		sender->env_tf.tf_regs.reg_eax = -E_BAD_ENV;
+		sched_set_status(sender, ENV_RUNNABLE);
+	}
+	e->env_ipc_senders_tail = NULL;
+	e->env_ipc_recving = false;
+
+	// Stop waiting for a reply, and fail the sys_ipc_call of
+	// everybody waiting for a reply from us.
+	if (e->env_ipc_call_to) {
+		struct Env **pp = &e->env_ipc_call_to->env_ipc_callers;
+		while (*pp != e)
+			pp = &(*pp)->env_ipc_call_next;
+		*pp = e->env_ipc_call_next;
+		e->env_ipc_call_to = NULL;
+		e->env_ipc_call_next = NULL;
+	}
+	while (e->env_ipc_callers) {
+		struct Env *client = e->env_ipc_callers;
+		e->env_ipc_callers = client->env_ipc_call_next;
+		client->env_ipc_call_next = NULL;
+		client->env_ipc_call_to = NULL;
+		client->env_ipc_recving = false;
+		client->env_ipc_recv_from = 0;
+		client->env_tf.tf_regs.reg_eax = -E_BAD_ENV;
+		sched_set_status(client, ENV_RUNNABLE);
+	}
+
+	notify_cancel(e);
+
 	// return the environment to the free list
-	e->env_status = ENV_FREE;
+	sched_set_status(e, ENV_FREE);
+	spin_lock(&env_table_lock);
 	e->env_link = env_free_list;
 	env_free_list = e;
+	spin_unlock(&env_table_lock);
 }
 
 //
@@ -623,9 +840,17 @@ env_free(struct Env *e)
 void
 env_destroy(struct Env *e)
 {
+	// If e is currently running on other CPUs, we change its state to
+	// ENV_DYING. A zombie environment will be freed the next time
+	// it traps to the kernel.  Otherwise e is taken off the run
+	// queues, so no other CPU can start running it meanwhile.
+	if (sched_make_zombie(e))
+		return;
+
 	env_free(e);
 
 	if (e == curenv) {
+		curenv = NULL;
 		sched_yield();
 	}
 }
@@ -733,13 +958,22 @@ env_run(struct Env *e)
 	//	and make sure you have set the relevant parts of
 	//	e->env_tf to sensible values.
 	
-	if (curenv != NULL && curenv->env_status == ENV_RUNNING) {
-		curenv->env_status = ENV_RUNNABLE;
+	sched_charge();
+	// Switch address spaces first: once the old environment is back
+	// on a run queue, another CPU may run it, or free it.
+	pgdir_load(e->env_pgdir);
+	if (curenv != NULL && curenv != e && curenv->env_status == ENV_RUNNING) {
+		sched_set_status(curenv, ENV_RUNNABLE);
 	}
 	curenv = e;
-	curenv->env_status = ENV_RUNNING;
+	sched_set_status(curenv, ENV_RUNNING);
 	curenv->env_runs++;
-	lcr3(PADDR(e->env_pgdir));
+	vsys[VSYS_cpu_envid + cpunum()] = curenv->env_id;
+
+	// Release the big kernel lock just before leaving the kernel.
+	// Nothing below touches shared kernel state.
+	if (kernel_locked())
+		unlock_kernel();
 	env_pop_tf(&curenv->env_tf);
 }
 
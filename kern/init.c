@@ -3,6 +3,7 @@
 #include <inc/stdio.h>
 #include <inc/string.h>
 #include <inc/assert.h>
+#include <inc/x86.h>
 
 #include <kern/monitor.h>
 #include <kern/tsc.h>
@@ -14,6 +15,10 @@
 #include <kern/cpu.h>
 #include <kern/picirq.h>
 #include <kern/kclock.h>
+#include <kern/spinlock.h>
+
+static void boot_aps(void);
+
 
 void
 i386_init(void)
@@ -54,12 +59,28 @@ i386_init(void)
 	env_init();
 	trap_init();
 
+#ifndef CONFIG_KSPACE
+	// Lab 4 multiprocessor initialization functions
+	mp_init();
+	lapic_init();
+#endif
+
 	clock_idt_init();
 
 	pic_init();
 	rtc_init();
 
-	irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_CLOCK));
+	// Without a local APIC the RTC drives the scheduler tick.
+	if (!lapicaddr)
+		irq_setmask_8259A(irq_mask_8259A & ~(1<<IRQ_CLOCK));
+
+	// Acquire the big kernel lock before waking up APs
+	lock_kernel();
+
+#ifndef CONFIG_KSPACE
+	// Starting non-boot CPUs
+	boot_aps();
+#endif
 
 #ifdef CONFIG_KSPACE
 	// Touch all you want.
@@ -98,6 +119,59 @@ i386_init(void)
 	env_run(&envs[0]);
 }
 
+// While boot_aps is booting a given CPU, it communicates the per-core
+// stack pointer that should be loaded by mpentry.S to that CPU in
+// this variable.
+void *mpentry_kstack;
+
+// Start the non-boot (AP) processors.
+static void
+boot_aps(void)
+{
+	extern unsigned char mpentry_start[], mpentry_end[];
+	void *code;
+	struct CpuInfo *c;
+
+	// Write entry code to unused memory at MPENTRY_PADDR
+	code = KADDR(MPENTRY_PADDR);
+	memmove(code, mpentry_start, mpentry_end - mpentry_start);
+
+	// Boot each AP one at a time
+	for (c = cpus; c < cpus + ncpu; c++) {
+		if (c == cpus + cpunum())  // We've started already.
+			continue;
+
+		// Tell mpentry.S what stack to use
+		mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
+		// Start the CPU at mpentry_start
+		lapic_startap(c->cpu_id, PADDR(code));
+		// Wait for the CPU to finish some basic setup in mp_main()
+		while(c->cpu_status != CPU_STARTED)
+			;
+	}
+}
+
+// Setup code for APs
+void
+mp_main(void)
+{
+	// We are in high EIP now, safe to switch to kern_pgdir
+	pgdir_load(kern_pgdir);
+	mem_init_pge();
+	cprintf("SMP: CPU %d starting\n", cpunum());
+
+	lapic_init();
+	env_init_percpu();
+	trap_init_percpu();
+	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
+
+	// Now that we have finished some basic setup, call sched_yield()
+	// to start running processes on this CPU.  But make sure that
+	// only one CPU can enter the scheduler at a time!
+	lock_kernel();
+	sched_yield();
+}
+
 
 /*
  * Variable panicstr contains argument to first call to panic; used as flag
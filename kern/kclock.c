@@ -5,6 +5,7 @@
 #include <inc/time.h>
 #include <inc/vsyscall.h>
 #include <kern/vsyscall.h>
+#include <kern/cpu.h>
 
 #include <inc/string.h>
 
@@ -98,7 +99,12 @@ rtc_init(void)
 	outb(IO_RTC_CMND, RTC_BREG);
 	// read data with port io from selected reg
 	uint8_t reg_b = inb(IO_RTC_DATA);
-	reg_b |= RTC_PIE;
+	// The periodic interrupt preempts environments only if there is
+	// no local APIC timer (see lapic_init), as with CONFIG_KSPACE.
+	// Otherwise the RTC is read just once, below, to start the
+	// software clock.
+	if (!lapicaddr)
+		reg_b |= RTC_PIE;
 	// force 24 hours instead of AM/PM
 	reg_b |= RTC_24;
 	// force binary-coded-decimal instead of binary
@@ -106,16 +112,18 @@ rtc_init(void)
 	// write data with port io to selected reg
 	outb(IO_RTC_DATA, reg_b);
 
-	// select reg A with port io
-	outb(IO_RTC_CMND, RTC_AREG);
-	uint8_t reg_a = inb(IO_RTC_DATA);
-	// set oscilator frequency the low 4 bits of A register
-	reg_a |= 0x0F;
-	outb(IO_RTC_DATA, reg_a);
+	if (!lapicaddr) {
+		// select reg A with port io
+		outb(IO_RTC_CMND, RTC_AREG);
+		uint8_t reg_a = inb(IO_RTC_DATA);
+		// set oscilator frequency the low 4 bits of A register
+		reg_a |= 0x0F;
+		outb(IO_RTC_DATA, reg_a);
+	}
 
 	nmi_enable();
 
-	vsys[VSYS_gettime] = gettime();
+	vsys_init(gettime());
 }
 
 uint8_t
@@ -13,6 +13,8 @@
 #include <kern/tsc.h>
 #include <kern/pmap.h>
 #include <kern/trap.h>
+#include <kern/spinlock.h>
+#include <kern/syscall.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -31,6 +33,8 @@ static struct Command commands[] = {
 	{ "bt", "View backtrace", mon_backtrace },
 	{ "timer_start", "Start timer", mon_tstart },
 	{ "timer_stop", "Stop timer and display time delta", mon_tstop },
+	{ "lockstat", "Show the most contended spinlocks ('lockstat reset' clears)", mon_lockstat },
+	{ "sysstat", "Show system call counts ('sysstat NAME' for latencies, 'sysstat reset' clears)", mon_sysstat },
 };
 #define NCOMMANDS (sizeof(commands)/sizeof(commands[0]))
 
@@ -120,6 +124,98 @@ mon_tstop(int argc, char **argv, struct Trapframe *tf)
 	return 0;
 }
 
+#define LOCKSTAT_TOP	10
+
+int
+mon_lockstat(int argc, char **argv, struct Trapframe *tf)
+{
+	struct spinlock *top[LOCKSTAT_TOP];
+	struct spinlock *lk;
+	int n = 0, i;
+
+	if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+		for (lk = spinlock_stats; lk; lk = lk->stat_next)
+			lk->nacquire = lk->ncontended = lk->spin_cycles = 0;
+		return 0;
+	}
+
+	// Keep the LOCKSTAT_TOP most contended locks, most contended first.
+	for (lk = spinlock_stats; lk; lk = lk->stat_next) {
+		for (i = n; i > 0 && top[i - 1]->ncontended < lk->ncontended; i--)
+			if (i < LOCKSTAT_TOP)
+				top[i] = top[i - 1];
+		if (i < LOCKSTAT_TOP) {
+			top[i] = lk;
+			if (n < LOCKSTAT_TOP)
+				n++;
+		}
+	}
+
+	cprintf("%-16s %-8s %12s %12s %16s %10s\n", "lock", "addr",
+		"acquired", "contended", "spin cycles", "avg spin");
+	for (i = 0; i < n; i++) {
+		lk = top[i];
+		cprintf("%-16s %08x %12llu %12llu %16llu %10llu\n",
+			lk->name ? lk->name : "?", (uint32_t)lk,
+			lk->nacquire, lk->ncontended, lk->spin_cycles,
+			lk->ncontended ? lk->spin_cycles / lk->ncontended : 0);
+	}
+	return 0;
+}
+
+// Print the latency histogram of one system call.
+static void
+sysstat_hist(int num)
+{
+	const struct SyscallStats *st = &syscall_stats[num];
+	int i;
+
+	cprintf("%s: %u calls\n", syscalls[num].sc_name, st->sc_count);
+	cprintf("%12s %10s\n", "cycles <", "calls");
+	for (i = 0; i < NSYSHIST; i++) {
+		if (i < NSYSHIST - 1)
+			cprintf("%12u %10u\n", 1 << (SYSHIST_SHIFT + i), st->sc_hist[i]);
+		else
+			cprintf("%12s %10u\n", "inf", st->sc_hist[i]);
+	}
+}
+
+int
+mon_sysstat(int argc, char **argv, struct Trapframe *tf)
+{
+	const struct SyscallStats *st;
+	uint32_t timed;
+	int i, j;
+
+	if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+		memset(syscall_stats, 0, NSYSCALLS * sizeof(struct SyscallStats));
+		return 0;
+	}
+
+	if (argc > 1) {
+		for (i = 0; i < NSYSCALLS; i++)
+			if (syscalls[i].sc_name &&
+			    strcmp(argv[1], syscalls[i].sc_name) == 0) {
+				sysstat_hist(i);
+				return 0;
+			}
+		cprintf("Unknown system call '%s'\n", argv[1]);
+		return 0;
+	}
+
+	cprintf("%-24s %10s %10s %12s\n", "syscall", "calls", "timed",
+		"avg cycles");
+	for (i = 0; i < NSYSCALLS; i++) {
+		st = &syscall_stats[i];
+		if (st->sc_count == 0)
+			continue;
+		for (timed = 0, j = 0; j < NSYSHIST; j++)
+			timed += st->sc_hist[j];
+		cprintf("%-24s %10u %10u %12llu\n", syscalls[i].sc_name,
+			st->sc_count, timed, timed ? st->sc_cycles / timed : 0);
+	}
+	return 0;
+}
 
 /***** Kernel monitor command interpreter *****/
 
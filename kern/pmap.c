@@ -8,9 +8,11 @@
 #include <inc/vsyscall.h>
 
 #include <kern/vsyscall.h>
+#include <kern/syscall.h>
 #include <kern/pmap.h>
 #include <kern/kclock.h>
 #include <kern/env.h>
+#include <kern/spinlock.h>
 
 #ifdef SANITIZE_SHADOW_BASE
 // asan unpoison routine used for whitelisting regions.
@@ -28,6 +30,43 @@ int *vsys;  // Virtual syscall space
 pde_t *kern_pgdir;		// Kernel's initial page directory
 struct PageInfo *pages;		// Physical page state array
 static struct PageInfo *page_free_list;	// Free list of physical pages
+static struct spinlock page_lock;	// Protects the free lists
+static struct spinlock ptshare_lock;	// Protects sharing of page tables
+
+// Binary buddy allocator.  Free memory is kept in blocks of 2^order
+// pages, aligned to their size, on one list per order.  A block's
+// buddy is the block it was split from, found by flipping bit 'order'
+// of its page number; a freed block is merged with its buddy whenever
+// the buddy is free too.  During boot free pages sit on page_free_list
+// instead, since mem_init's checks take it apart by hand; buddy_init
+// moves them over once those checks are done.
+static struct PageInfo *buddy_lists[PAGE_MAX_ORDER + 1];
+static bool buddy_on;
+
+// Per-CPU caches ("magazines") of free pages in front of the buddy
+// allocator.  page_alloc and page_free only touch the current CPU's
+// cache, and take page_lock once per PCACHE_BATCH pages when the
+// cache runs empty or full.
+#define PCACHE_SIZE	64
+#define PCACHE_BATCH	(PCACHE_SIZE / 2)
+
+static struct PageCache {
+	struct PageInfo *pc_pages[PCACHE_SIZE];
+	uint32_t pc_count;
+	volatile bool pc_drain;		// Give all pages back, see page_reclaim
+} page_caches[NCPU] __attribute__((aligned(64)));
+
+// Pages zeroed ahead of time by idle CPUs (see page_zero_idle), so that
+// page_alloc(ALLOC_ZERO) usually need not clear a page itself.  They are
+// allocated as far as the buddy allocator is concerned.
+#define PZERO_TARGET	256	// Keep this many zeroed pages around
+#define PZERO_BATCH	8	// Zero at most this many per idle pass
+
+static struct PageInfo *page_zero_list;
+static uint32_t page_zero_count;
+static struct spinlock zero_lock = {
+	.name = "zero_lock"
+};
 
 
 // --------------------------------------------------------------
@@ -61,6 +100,16 @@ i386_detect_memory(void)
 	else
 		npages = npages_basemem;
 
+	// The kernel reaches physical memory through the window at
+	// KERNBASE, so memory beyond the window's end cannot be used.
+	size_t npages_window = (0x100000000ULL - KERNBASE) / PGSIZE;
+	if (npages > npages_window) {
+		cprintf("Physical memory: ignoring %uK above %uK\n",
+			(npages - npages_window) * PGSIZE / 1024,
+			npages_window * PGSIZE / 1024);
+		npages = npages_window;
+	}
+
 	cprintf("Physical memory: %uK available, base = %uK, extended = %uK, pextended = %uK\n",
 		npages * PGSIZE / 1024,
 		npages_basemem * PGSIZE / 1024,
@@ -74,12 +123,19 @@ i386_detect_memory(void)
 // --------------------------------------------------------------
 
 static void boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm);
+static void mem_init_mp(void);
+static void page_init_high(void);
 static void check_page_free_list(bool only_low_memory);
 static void check_page_alloc(void);
 static void check_kern_pgdir(void);
 static physaddr_t check_va2pa(pde_t *pgdir, uintptr_t va);
 static void check_page(void);
 static void check_page_installed_pgdir(void);
+static void buddy_init(void);
+static void check_buddy(void);
+static void tlb_defer_flush(void);
+static void tlb_defer_shootdown(pde_t *pgdir);
+static void tlb_page_decref(struct PageInfo *pp);
 
 // only from boot_alloc function
 static char *nextfree;	// virtual address of next byte of free memory
@@ -116,9 +172,11 @@ boot_alloc(uint32_t n)
 	//
 	// LAB 6: Your code here.
 
+	// Only the first BOOTMEMSIZE bytes of physical memory are mapped
+	// until mem_init switches to kern_pgdir.
 	char *result = nextfree;
 	nextfree += ROUNDUP(n, PGSIZE);
-	if ((uint32_t)nextfree > (uint32_t)end + BOOTMEMSIZE) {
+	if ((uint32_t)nextfree > KERNBASE + BOOTMEMSIZE) {
 		panic("out of memory.\n");
 	}
 	return result;
@@ -185,6 +243,14 @@ mem_init(void)
 	vsys = boot_alloc(sizeof(int32_t) * NVSYSCALLS);
 	memset(vsys, 0, sizeof(int32_t) * NVSYSCALLS);
 
+	//////////////////////////////////////////////////////////////////////
+	// Make 'syscall_stats' point to a page of 'struct SyscallStats',
+	// one per system call.  boot_alloc hands out whole pages, so the
+	// user sees nothing else through its mapping.
+	static_assert(NSYSCALLS * sizeof(struct SyscallStats) <= PGSIZE);
+	syscall_stats = boot_alloc(PGSIZE);
+	memset(syscall_stats, 0, PGSIZE);
+
 	//////////////////////////////////////////////////////////////////////
 	// Now that we've allocated the initial kernel data structures, we set
 	// up the list of free physical pages. Once we've done so, all further
@@ -211,7 +277,7 @@ mem_init(void)
 	uint32_t n = ROUNDUP(npages*sizeof(struct PageInfo), PGSIZE);
 	for (i = 0; i < n; i += PGSIZE) {
 		struct PageInfo* page_with_pages_array = pa2page(PADDR(pages) + i);
-		page_insert(kern_pgdir, page_with_pages_array, (void*)(UPAGES + i), PTE_U);
+		page_insert(kern_pgdir, page_with_pages_array, (void*)(UPAGES + i), PTE_U | PTE_G);
 		// this is a hack, because page_insert increments ref
 		page_with_pages_array->pp_ref--;
 	}
@@ -227,7 +293,7 @@ mem_init(void)
 	n = ROUNDUP(NENV*sizeof(struct Env), PGSIZE);
 	for (i = 0; i < n; i += PGSIZE) {
 		struct PageInfo* page_with_envs_array = pa2page(PADDR(envs) + i);
-		page_insert(kern_pgdir, page_with_envs_array, (void*)(UENVS + i), PTE_U);
+		page_insert(kern_pgdir, page_with_envs_array, (void*)(UENVS + i), PTE_U | PTE_G);
 		// this is a hack, because page_insert increments ref
 		page_with_envs_array->pp_ref--;
 	}
@@ -243,29 +309,24 @@ mem_init(void)
 	n = ROUNDUP(NVSYSCALLS * sizeof(int32_t), PGSIZE);
 	for (i = 0; i < n; i += PGSIZE) {
 		struct PageInfo* page_with_vsys_ints = pa2page(PADDR(vsys) + i);
-		page_insert(kern_pgdir, page_with_vsys_ints, (void*)(UVSYS + i), PTE_U);
+		page_insert(kern_pgdir, page_with_vsys_ints, (void*)(UVSYS + i), PTE_U | PTE_G);
 		// this is a hack, because page_insert increments ref
 		page_with_vsys_ints->pp_ref--;
 	}
 
 	//////////////////////////////////////////////////////////////////////
-	// Use the physical memory that 'bootstack' refers to as the kernel
-	// stack.  The kernel stack grows down from virtual address KSTACKTOP.
-	// We consider the entire range from [KSTACKTOP-PTSIZE, KSTACKTOP)
-	// to be the kernel stack, but break this into two pieces:
-	//     * [KSTACKTOP-KSTKSIZE, KSTACKTOP) -- backed by physical memory
-	//     * [KSTACKTOP-PTSIZE, KSTACKTOP-KSTKSIZE) -- not backed; so if
-	//       the kernel overflows its stack, it will fault rather than
-	//       overwrite memory.  Known as a "guard page".
-	//     Permissions: kernel RW, user NONE
-	// Your code goes here:
-	//
-	for (i = 0; i < KSTKSIZE; i += PGSIZE) {
-		struct PageInfo* page_with_bootstack = pa2page(PADDR(bootstack) + i);
-		page_insert(kern_pgdir, page_with_bootstack, (void*)(KSTACKTOP - KSTKSIZE + i), PTE_W);
-		// this is a hack, because page_insert increments ref
-		page_with_bootstack->pp_ref--;
-	}
+	// Map the system call statistics read-only by the user at USYSSTATS.
+	// The page is the last one of the UENVS region, so the envs array
+	// must end before it.
+	static_assert(NENV * sizeof(struct Env) <= USYSSTATS - UENVS);
+	struct PageInfo *page_with_stats = pa2page(PADDR(syscall_stats));
+	page_insert(kern_pgdir, page_with_stats, (void *) USYSSTATS, PTE_U | PTE_G);
+	// the same hack as for envs and vsys
+	page_with_stats->pp_ref--;
+
+	//////////////////////////////////////////////////////////////////////
+	// Map the per-CPU kernel stacks below KSTACKTOP.
+	mem_init_mp();
 
 	//////////////////////////////////////////////////////////////////////
 	// Map all of physical memory at KERNBASE.
@@ -275,27 +336,7 @@ mem_init(void)
 	// we just set up the mapping anyway.
 	// Permissions: kernel RW, user NONE
 	// Your code goes here:
-	i = 0;
-	for (i=0; i < npages; i++) {
-		struct PageInfo* pg = pa2page(i * PGSIZE);
-		if (!pg) {
-			continue;
-		}
-		page_insert(kern_pgdir, pg, (void*)(KERNBASE + i * PGSIZE), PTE_W);
-		// this is a hack, because page_insert increments ref
-		pg->pp_ref--;
-	}
-
-	// mark them availiable even though they are not
-	for (i = 0; i < NPDENTRIES; i++) {
-		if (i >= PDX(KERNBASE) && i >= PDX(KERNBASE + npages*PGSIZE)) {
-			// but forcefully mark only the ones that
-			// point to non-existent physical memory
-			// the ones that points to existing memory should already be marked ok
-			kern_pgdir[i] |= PTE_P;
-			kern_pgdir[i] |= PTE_W;
-		}
-	}
+	boot_map_region(kern_pgdir, KERNBASE, 0x100000000ULL - KERNBASE, 0, PTE_W | PTE_G);
 
 	// Check that the initial page directory has been set up correctly.
 	check_kern_pgdir();
@@ -307,7 +348,10 @@ mem_init(void)
 	//
 	// If the machine reboots at this point, you've probably set up your
 	// kern_pgdir wrong.
-	lcr3(PADDR(kern_pgdir));
+	pgdir_load(kern_pgdir);
+
+	// Now all of physical memory is mapped: hand out the rest of it.
+	page_init_high();
 
 	check_page_free_list(0);
 
@@ -319,9 +363,57 @@ mem_init(void)
 		cr0 &= ~(CR0_TS|CR0_EM);
 		lcr0(cr0);
 	}
+	mem_init_pge();
 
 	// Some more checks, only possible after kern_pgdir is installed.
 	check_page_installed_pgdir();
+
+	buddy_init();
+	check_buddy();
+}
+
+// Let the TLB keep the kernel's mappings across address space switches.
+// The mappings above UTOP that are the same in every address space are
+// marked PTE_G, and with CR4_PGE set an lcr3 does not flush them, so
+// env_run and sched_yield only lose the user half of the TLB.  UVPT is
+// different in each address space and must never be PTE_G.  A changed
+// global mapping needs an explicit invlpg, as tlb_invalidate does.
+// Called on every CPU once it runs on kern_pgdir.  Without CONFIG_PGE
+// the PTE_G bits are simply ignored.
+void
+mem_init_pge(void)
+{
+#ifdef CONFIG_PGE
+	lcr4(rcr4() | CR4_PGE);
+#endif
+}
+
+// Modify mappings in kern_pgdir to support SMP
+//   - Map the per-CPU stacks in the region [KSTACKTOP-PTSIZE, KSTACKTOP)
+//
+static void
+mem_init_mp(void)
+{
+	// Map per-CPU stacks starting at KSTACKTOP, for up to 'NCPU' CPUs.
+	//
+	// For CPU i, use the physical memory that 'percpu_kstacks[i]' refers
+	// to as its kernel stack. CPU i's kernel stack grows down from virtual
+	// address kstacktop_i = KSTACKTOP - i * (KSTKSIZE + KSTKGAP), and is
+	// divided into two pieces, just like the single stack you set up in
+	// mem_init:
+	//     * [kstacktop_i - KSTKSIZE, kstacktop_i)
+	//          -- backed by physical memory
+	//     * [kstacktop_i - (KSTKSIZE + KSTKGAP), kstacktop_i - KSTKSIZE)
+	//          -- not backed; so if the kernel overflows its stack,
+	//             it will fault rather than overwrite another CPU's stack.
+	//             Known as a "guard page".
+	//     Permissions: kernel RW, user NONE
+	//
+	for (int i = 0; i < NCPU; i++) {
+		uintptr_t kstacktop_i = KSTACKTOP - i * (KSTKSIZE + KSTKGAP);
+		boot_map_region(kern_pgdir, kstacktop_i - KSTKSIZE, KSTKSIZE,
+				PADDR(percpu_kstacks[i]), PTE_W | PTE_G);
+	}
 }
 
 // --------------------------------------------------------------
@@ -339,6 +431,9 @@ mem_init(void)
 void
 page_init(void)
 {
+	mcs_initlock(&page_lock);
+	spin_initlock(&ptshare_lock);
+
 	// The example code here marks all physical pages as free.
 	// However this is not truly the case.  What memory is free?
 	//  1) Mark physical page 0 as in use.
@@ -373,6 +468,10 @@ page_init(void)
 			// cprintf("%p\t%p\t%x\tbad\n", pp, page2kva(pp), page2pa(pp));
 			continue;
 		}
+		if (addr == MPENTRY_PADDR) {
+			// AP bootstrap code, see boot_aps()
+			continue;
+		}
 		if (IOPHYSMEM <= addr && addr < EXTPHYSMEM) {
 			// cprintf("%p\t%p\t%x\tbad\n", pp, page2kva(pp), page2pa(pp));
 			continue;
@@ -381,8 +480,9 @@ page_init(void)
 			// cprintf("%p\t%p\t%x\tbad\n", pp, page2kva(pp), page2pa(pp));
 			continue;
 		}
-		if ((uint32_t)(nextfree - KERNBASE + BOOTMEMSIZE) <= addr) {
-			// cprintf("%p\t%p\t%x\tbad\n", pp, page2kva(pp), page2pa(pp));
+		if (BOOTMEMSIZE <= addr) {
+			// Not mapped by entry_pgdir, so it cannot be used
+			// before the switch to kern_pgdir: see page_init_high.
 			continue;
 		}
 
@@ -404,6 +504,230 @@ page_init(void)
 	}
 }
 
+//
+// Add the physical memory above BOOTMEMSIZE to the free list.  Called
+// once kern_pgdir, which maps all of it at KERNBASE, is loaded.
+//
+static void
+page_init_high(void)
+{
+	size_t i;
+
+	for (i = npages; i-- > BOOTMEMSIZE / PGSIZE; ) {
+		pages[i].pp_ref = 0;
+		pages[i].pp_link = page_free_list;
+		page_free_list = &pages[i];
+	}
+}
+
+// Put the free block of 2^order pages starting at pp on its list.
+static void
+buddy_push(struct PageInfo *pp, int order)
+{
+	pp->pp_free = 1;
+	pp->pp_order = order;
+	pp->pp_prev = NULL;
+	pp->pp_link = buddy_lists[order];
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp;
+	buddy_lists[order] = pp;
+}
+
+// Take the free block starting at pp off its list.
+static void
+buddy_remove(struct PageInfo *pp)
+{
+	if (pp->pp_prev)
+		pp->pp_prev->pp_link = pp->pp_link;
+	else
+		buddy_lists[pp->pp_order] = pp->pp_link;
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp->pp_prev;
+	pp->pp_free = 0;
+	pp->pp_link = pp->pp_prev = NULL;
+}
+
+// Allocate a block of 2^order pages, splitting a larger one if
+// there is no free block of that order.  Caller holds page_lock.
+static struct PageInfo *
+buddy_alloc(int order)
+{
+	int o;
+
+	for (o = order; o <= PAGE_MAX_ORDER && !buddy_lists[o]; o++)
+		;
+	if (o > PAGE_MAX_ORDER)
+		return NULL;
+
+	struct PageInfo *pp = buddy_lists[o];
+	buddy_remove(pp);
+	// Keep the lower half, free the upper one.
+	while (o-- > order)
+		buddy_push(pp + (1 << o), o);
+	// page_decref frees the block by this order.
+	pp->pp_order = order;
+	return pp;
+}
+
+// Free the block of 2^order pages starting at pp, merging it with
+// its buddy for as long as the buddy is free.  Caller holds page_lock.
+static void
+buddy_free(struct PageInfo *pp, int order)
+{
+	uint32_t pgnum = pp - pages;
+
+	while (order < PAGE_MAX_ORDER) {
+		uint32_t buddy = pgnum ^ (1 << order);
+		if (buddy >= npages || !pages[buddy].pp_free ||
+		    pages[buddy].pp_order != order)
+			break;
+		buddy_remove(&pages[buddy]);
+		pgnum &= ~(1 << order);
+		order++;
+	}
+	buddy_push(&pages[pgnum], order);
+}
+
+// Move the free pages from page_free_list to the buddy allocator,
+// which from now on serves every page_alloc.
+static void
+buddy_init(void)
+{
+	struct PageInfo *pp, *next;
+
+	spin_lock(&page_lock);
+	for (pp = page_free_list; pp; pp = next) {
+		next = pp->pp_link;
+		buddy_free(pp, 0);
+	}
+	page_free_list = NULL;
+	buddy_on = true;
+	spin_unlock(&page_lock);
+}
+
+// Give all the pages in 'pc' back to the buddy lists.  Caller holds
+// page_lock, with interrupts off if 'pc' is this CPU's cache.
+static void
+page_cache_drain(struct PageCache *pc)
+{
+	while (pc->pc_count)
+		buddy_free(pc->pc_pages[--pc->pc_count], 0);
+	pc->pc_drain = false;
+}
+
+//
+// Give the free pages held back from the buddy lists, in the zero pool
+// and in this CPU's cache, back to them, so that they can merge with
+// their buddies into larger blocks.  The other CPUs' caches are only
+// touched by their own CPUs, so those are asked to drain on their next
+// page_alloc or page_free.
+//
+static void
+page_reclaim(void)
+{
+	struct PageInfo *zl, *pp;
+	int i;
+
+	spin_lock(&zero_lock);
+	zl = page_zero_list;
+	page_zero_list = NULL;
+	page_zero_count = 0;
+	spin_unlock(&zero_lock);
+
+	uint32_t eflags = read_eflags();
+	asm volatile("cli");
+	spin_lock(&page_lock);
+	while ((pp = zl) != NULL) {
+		zl = pp->pp_link;
+		buddy_free(pp, 0);
+	}
+	page_cache_drain(&page_caches[cpunum()]);
+	spin_unlock(&page_lock);
+	write_eflags(eflags);
+
+	for (i = 0; i < ncpu; i++)
+		if (i != cpunum())
+			page_caches[i].pc_drain = true;
+}
+
+// Take a page from the pool of zeroed pages, or return NULL if it is empty.
+static struct PageInfo *
+page_zero_pop(void)
+{
+	struct PageInfo *pp;
+
+	// Unlocked peek: not worth taking the lock for an empty pool.
+	if (!page_zero_count)
+		return NULL;
+	spin_lock(&zero_lock);
+	if ((pp = page_zero_list) != NULL) {
+		page_zero_list = pp->pp_link;
+		page_zero_count--;
+	}
+	spin_unlock(&zero_lock);
+	return pp;
+}
+
+//
+// Refill the pool of zeroed pages a little.  Called by a CPU that has
+// nothing else to do, with no locks held.  Zeroes at most PZERO_BATCH
+// pages, so that the CPU soon gets back to checking for work.
+//
+void
+page_zero_idle(void)
+{
+	struct PageInfo *pp;
+
+	for (int i = 0; i < PZERO_BATCH && page_zero_count < PZERO_TARGET; i++) {
+		spin_lock(&page_lock);
+		pp = buddy_on ? buddy_alloc(0) : NULL;
+		spin_unlock(&page_lock);
+		if (!pp) {
+			return;
+		}
+
+		memset(page2kva(pp), 0, PGSIZE);
+
+		spin_lock(&zero_lock);
+		pp->pp_link = page_zero_list;
+		page_zero_list = pp;
+		page_zero_count++;
+		spin_unlock(&zero_lock);
+	}
+}
+
+// Take a page from this CPU's cache, refilling it from the buddy lists
+// if it is empty.  Returns NULL if there are no free pages.
+static struct PageInfo *
+page_cache_alloc(void)
+{
+	struct PageInfo *p;
+
+	// The cache belongs to this CPU, so only an interrupt could
+	// touch it behind our back: the kernel runs with them on
+	// under CONFIG_KSPACE.
+	uint32_t eflags = read_eflags();
+	asm volatile("cli");
+	struct PageCache *pc = &page_caches[cpunum()];
+	if (pc->pc_drain) {
+		spin_lock(&page_lock);
+		page_cache_drain(pc);
+		spin_unlock(&page_lock);
+	}
+	if (!pc->pc_count) {
+		// Refill half the cache in one trip to the buddy lists.
+		spin_lock(&page_lock);
+		while (pc->pc_count < PCACHE_BATCH &&
+		       (p = buddy_alloc(0)) != NULL) {
+			pc->pc_pages[pc->pc_count++] = p;
+		}
+		spin_unlock(&page_lock);
+	}
+	p = pc->pc_count ? pc->pc_pages[--pc->pc_count] : NULL;
+	write_eflags(eflags);
+	return p;
+}
+
 //
 // Allocates a physical page.  If (alloc_flags & ALLOC_ZERO), fills the entire
 // returned physical page with '\0' bytes.  Does NOT increment the reference
@@ -420,18 +744,38 @@ struct PageInfo *
 page_alloc(int alloc_flags)
 {
 	// Fill this function in
-	if (! page_free_list) {
-		return NULL;
+	struct PageInfo *p;
+	bool zeroed = false;
+
+	if ((alloc_flags & ALLOC_ZERO) && (p = page_zero_pop()) != NULL) {
+		zeroed = true;
+	} else if (!buddy_on) {
+		spin_lock(&page_lock);
+		if ((p = page_free_list) != NULL)
+			page_free_list = p->pp_link;
+		spin_unlock(&page_lock);
+	} else {
+		p = page_cache_alloc();
 	}
 
-	struct PageInfo *p = page_free_list;
+	// Out of plain free pages: the zeroed ones are just as good.
+	if (!p && (p = page_zero_pop()) != NULL) {
+		zeroed = true;
+	}
+	// Then take back what the caches hold and try once more.
+	if (!p && buddy_on) {
+		page_reclaim();
+		p = page_cache_alloc();
+	}
+	if (!p) {
+		return NULL;
+	}
 	if (p->pp_ref > 0) {
 		panic("pp_ref is not zero for a free page, this page should not be in the free list\n");
 	}
-	page_free_list = p->pp_link;
 	p->pp_link = NULL;
 
-	if (alloc_flags & ALLOC_ZERO) {
+	if ((alloc_flags & ALLOC_ZERO) && !zeroed) {
 		memset(page2kva(p), 0, PGSIZE);
 	}
 
@@ -457,8 +801,93 @@ page_free(struct PageInfo *pp)
 	}
 	pp->pp_ref = 0;
 
-	pp->pp_link = page_free_list;
-	page_free_list = pp;
+	if (!buddy_on) {
+		spin_lock(&page_lock);
+		pp->pp_link = page_free_list;
+		page_free_list = pp;
+		spin_unlock(&page_lock);
+		return;
+	}
+
+	uint32_t eflags = read_eflags();
+	asm volatile("cli");
+	struct PageCache *pc = &page_caches[cpunum()];
+	if (pc->pc_drain) {
+		spin_lock(&page_lock);
+		page_cache_drain(pc);
+		spin_unlock(&page_lock);
+	}
+	if (pc->pc_count == PCACHE_SIZE) {
+		// Give the oldest half of the cache back to the buddy lists.
+		spin_lock(&page_lock);
+		for (int i = 0; i < PCACHE_BATCH; i++) {
+			buddy_free(pc->pc_pages[i], 0);
+		}
+		spin_unlock(&page_lock);
+		memmove(pc->pc_pages, pc->pc_pages + PCACHE_BATCH,
+			(PCACHE_SIZE - PCACHE_BATCH) * sizeof(pc->pc_pages[0]));
+		pc->pc_count -= PCACHE_BATCH;
+	}
+	pc->pc_pages[pc->pc_count++] = pp;
+	write_eflags(eflags);
+}
+
+//
+// Allocates 2^order physically contiguous pages, aligned to their size,
+// for example for DMA buffers or 4MB superpages.  Like page_alloc, does
+// NOT increment the reference count; only the first page's pp_ref
+// is meant to be used.  Free the block with page_free_order and the
+// same order.
+//
+// Returns NULL if there is no free block that large, even after
+// page_reclaim.
+//
+struct PageInfo *
+page_alloc_order(int order, int alloc_flags)
+{
+	struct PageInfo *pp;
+
+	assert(order >= 0 && order <= PAGE_MAX_ORDER);
+	if (order == 0 || !buddy_on) {
+		return order == 0 ? page_alloc(alloc_flags) : NULL;
+	}
+
+	spin_lock(&page_lock);
+	pp = buddy_alloc(order);
+	spin_unlock(&page_lock);
+	if (!pp) {
+		page_reclaim();
+		spin_lock(&page_lock);
+		pp = buddy_alloc(order);
+		spin_unlock(&page_lock);
+	}
+	if (!pp) {
+		return NULL;
+	}
+	if (alloc_flags & ALLOC_ZERO) {
+		memset(page2kva(pp), 0, PGSIZE << order);
+	}
+	return pp;
+}
+
+//
+// Return a block from page_alloc_order to the free lists.
+//
+void
+page_free_order(struct PageInfo *pp, int order)
+{
+	assert(order >= 0 && order <= PAGE_MAX_ORDER);
+	if (order == 0) {
+		page_free(pp);
+		return;
+	}
+	if (pp->pp_ref > 0 || pp->pp_link || (pp - pages) % (1 << order)) {
+		panic("invalid free of page block, ref > 0, link != NULL or misaligned");
+	}
+
+	spin_lock(&page_lock);
+	buddy_free(pp, order);
+	spin_unlock(&page_lock);
 }
 
 //
@@ -468,8 +897,9 @@ page_free(struct PageInfo *pp)
 void
 page_decref(struct PageInfo* pp)
 {
-	if (--pp->pp_ref == 0)
-		page_free(pp);
+	// A block from page_alloc_order is freed whole.
+	if (__sync_sub_and_fetch(&pp->pp_ref, 1) == 0)
+		page_free_order(pp, pp->pp_order);
 }
 
 // Given 'pgdir', a pointer to a page directory, pgdir_walk returns
@@ -494,12 +924,28 @@ page_decref(struct PageInfo* pp)
 // Hint 3: look at inc/mmu.h for useful macros that mainipulate page
 // table and page directory entries.
 //
+// A PDE with PTE_PS maps a 4MB page and has no page table, so then
+// pgdir_walk returns NULL whatever 'create' says.
+//
 pte_t *
 pgdir_walk(pde_t *pgdir, const void *va, int create)
 {
 	// Fill this function in
 	pde_t cur_entry = pgdir[PDX(va)];
 
+	// A page table shared since fork must be split before
+	// anybody changes it.
+	if (create && (cur_entry & PDE_PTSHARED)) {
+		if (pgdir_unshare(pgdir, va) < 0) {
+			return NULL;
+		}
+		cur_entry = pgdir[PDX(va)];
+	}
+
+	if ((cur_entry & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)) {
+		return NULL;
+	}
+
 	if (cur_entry && (cur_entry & PTE_P)) {
 		// all is well
 		pte_t* cur_table = (pte_t*)KADDR(PTE_ADDR(cur_entry));
@@ -534,6 +980,9 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 // above UTOP. As such, it should *not* change the pp_ref field on the
 // mapped pages.
 //
+// Wherever va and pa are both 4MB-aligned and at least 4MB remain,
+// a single 4MB page (PTE_PS) is used instead of a page table.
+//
 // Hint: the TA solution uses pgdir_walk
 static void
 boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm)
@@ -541,10 +990,17 @@ boot_map_region(pde_t *pgdir, uintptr_t va, size_t size, physaddr_t pa, int perm
 	// Fill this function in
 	uint32_t i = 0;
 	uint32_t permissions = perm | PTE_P;
-	for (i = 0; i < size; i += PGSIZE) {
+	while (i < size) {
+		if ((va + i) % PTSIZE == 0 && (pa + i) % PTSIZE == 0 &&
+		    size - i >= PTSIZE) {
+			pgdir[PDX(va + i)] = (pa + i) | permissions | PTE_PS;
+			i += PTSIZE;
+			continue;
+		}
 		pte_t* entry_ptr = pgdir_walk(pgdir, (uint8_t *)(va + i), true);
 		pte_t entry_val = (pa + i) | permissions;
 		*entry_ptr = entry_val;
+		i += PGSIZE;
 	}
 }
 
@@ -578,12 +1034,13 @@ page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
 {
 	// Fill this function in
 	// increment ref++ ahead of time so page does not get into free list
-	pp->pp_ref++;
-	page_remove(pgdir, va);
-	pte_t* entry_ptr = pgdir_walk(pgdir, va, true);
+	page_incref(pp);
+	pte_t* entry_ptr = NULL;
+	if (page_remove(pgdir, va) == 0)
+		entry_ptr = pgdir_walk(pgdir, va, true);
 	if (!entry_ptr) {
 		// cancel initial ref++
-		pp->pp_ref--;
+		__sync_fetch_and_sub(&pp->pp_ref, 1);
 		return -E_NO_MEM;
 	}
 	// if all is ok, dont cancel initial ref++
@@ -595,6 +1052,29 @@ page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
 	return 0;
 }
 
+//
+// Map the 4MB block 'pp' from page_alloc_order(PAGE_MAX_ORDER, ...)
+// at the 4MB-aligned user address 'va' with a single PTE_PS entry in
+// the page directory.  The block's first page counts the mappings;
+// page_remove on any address in the block unmaps all of it.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if anything is already mapped in [va, va + 4MB)
+//
+int
+page_insert_large(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
+{
+	assert((uintptr_t)va % PTSIZE == 0 && (pp - pages) % NPTENTRIES == 0);
+	if (pgdir[PDX(va)] & PTE_P) {
+		return -E_INVAL;
+	}
+	page_incref(pp);
+	pgdir[PDX(va)] = page2pa(pp) | perm | PTE_P | PTE_PS;
+	tlb_invalidate(pgdir, va);
+	return 0;
+}
+
 //
 // Return the page mapped at virtual address 'va'.
 // If pte_store is not zero, then we store in it the address
@@ -604,12 +1084,25 @@ page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm)
 //
 // Return NULL if there is no page mapped at va.
 //
+// Inside a 4MB page (see page_insert_large), returns the 4K page at va
+// and stores the address of the PDE instead of a PTE.  Such a page has
+// no reference count of its own, so it must not be mapped anywhere
+// else: callers that would map it check for PTE_PS.
+//
 // Hint: the TA solution uses pgdir_walk and pa2page.
 //
 struct PageInfo *
 page_lookup(pde_t *pgdir, void *va, pte_t **pte_store)
 {
 	// Fill this function in
+	pde_t *pde = &pgdir[PDX(va)];
+	if ((*pde & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)) {
+		if (pte_store) {
+			*pte_store = pde;
+		}
+		return pa2page(PTE_ADDR(*pde) + ((uintptr_t)va & (PTSIZE - PGSIZE)));
+	}
+
 	pte_t* entry_ptr = pgdir_walk(pgdir, va, false);
 	if (!entry_ptr) {
 		return NULL;
@@ -641,33 +1134,424 @@ page_lookup(pde_t *pgdir, void *va, pte_t **pte_store)
 // Hint: The TA solution is implemented using page_lookup,
 // 	tlb_invalidate, and page_decref.
 //
-void
+// RETURNS:
+//   0 on success
+//   -E_NO_MEM, if the page table is shared since fork and couldn't
+//   be split (see pgdir_unshare); nothing is unmapped then
+//
+int
 page_remove(pde_t *pgdir, void *va)
 {
 	// Fill this function in
+	// A 4MB page goes away as a whole.
+	pde_t *pde = &pgdir[PDX(va)];
+	// The page is released only once no TLB can map it any more,
+	// or another CPU could hand it out while it is still written.
+	if ((*pde & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)) {
+		struct PageInfo *pp = pa2page(PTE_ADDR(*pde));
+		*pde = 0;
+		tlb_invalidate(pgdir, va);
+		tlb_page_decref(pp);
+		return 0;
+	}
+
 	pte_t* entry_ptr = NULL;
 	struct PageInfo* pginfo = page_lookup(pgdir, va, &entry_ptr);
 	if (! pginfo) {
 		// nothing to do, the page was not mapped
-		return;
+		return 0;
+	}
+	if (pgdir_unshare(pgdir, va) < 0) {
+		return -E_NO_MEM;
 	}
-	page_decref(pginfo);
+	pginfo = page_lookup(pgdir, va, &entry_ptr);
 	if (entry_ptr) {
 		*entry_ptr = 0;
 	}
 	tlb_invalidate(pgdir, va);
+	tlb_page_decref(pginfo);
+	return 0;
+}
+
+//
+// Make the writable PTEs of page table 'pt' copy-on-write: clear
+// PTE_W and set PTE_COW, except on pages marked PTE_SHARE.
+//
+static void
+pt_mark_cow(pte_t *pt)
+{
+	uint32_t pteno;
+
+	for (pteno = 0; pteno < NPTENTRIES; pteno++) {
+		pte_t pte = pt[pteno];
+		if ((pte & PTE_P) && (pte & (PTE_W | PTE_COW)) &&
+		    !(pte & PTE_SHARE))
+			pt[pteno] = (pte & ~PTE_W) | PTE_COW;
+	}
+}
+
+//
+// Copy the user part (below UTOP) of the address space 'src' into the
+// empty address space 'dst' for fork.
+//
+// Page tables are not copied: both page directories map the same page
+// table pages, read-only and marked PDE_PTSHARED, and each page table
+// page's pp_ref counts its sharers.  The first write fault in such
+// a 4MB region, or any change to its mappings, splits the page table
+// with pgdir_unshare.  Fork thus costs O(number of page tables).
+//
+// The page table that holds the user stack and the user exception
+// stack is copied right away, since it is written to at once and the
+// kernel writes trap frames to the exception stack.  Its writable
+// pages become copy-on-write, in both copies, and the exception
+// stack page is not copied at all: the child needs a fresh one.
+//
+// A 4MB page (PTE_PS) is shared if it has PTE_SHARE and copied
+// into a fresh 4MB block otherwise.
+//
+// Nothing is flushed from the TLB here.  If 'src' is the current
+// address space, the caller must flush the whole TLB afterwards,
+// since writable mappings of 'src' have become read-only.
+//
+// RETURNS:
+//   0 on success
+//   -E_NO_MEM, if a page table or a 4MB block couldn't be allocated.  'dst' may then
+//   be partially filled; env_free cleans it up.
+//
+int
+pgdir_fork(pde_t *dst, pde_t *src)
+{
+	uint32_t pdeno, pteno;
+
+	for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+		if (!(src[pdeno] & PTE_P))
+			continue;
+
+		// A 4MB page with PTE_SHARE is shared with the child, any
+		// other one is copied: it has no page table to make
+		// copy-on-write.
+		if ((src[pdeno] & PTE_PS) && (src[pdeno] & PTE_SHARE)) {
+			dst[pdeno] = src[pdeno];
+			page_incref(pa2page(PTE_ADDR(src[pdeno])));
+			continue;
+		}
+		if (src[pdeno] & PTE_PS) {
+			struct PageInfo *pp = page_alloc_order(PAGE_MAX_ORDER, 0);
+			if (!pp)
+				return -E_NO_MEM;
+			memcpy(page2kva(pp), KADDR(PTE_ADDR(src[pdeno])), PTSIZE);
+			page_incref(pp);
+			dst[pdeno] = page2pa(pp) | (src[pdeno] & (PTE_SYSCALL | PTE_PS));
+			continue;
+		}
+
+		if (pdeno != PDX(UXSTACKTOP - PGSIZE)) {
+			src[pdeno] = (src[pdeno] & ~PTE_W) | PDE_PTSHARED;
+			dst[pdeno] = src[pdeno];
+			page_incref(pa2page(PTE_ADDR(src[pdeno])));
+			continue;
+		}
+
+		pte_t *spt = KADDR(PTE_ADDR(src[pdeno]));
+		struct PageInfo *ptpage = page_alloc(ALLOC_ZERO);
+		if (!ptpage)
+			return -E_NO_MEM;
+		ptpage->pp_ref++;
+		dst[pdeno] = page2pa(ptpage) | PTE_P | PTE_W | PTE_U;
+		pte_t *dpt = page2kva(ptpage);
+
+		pt_mark_cow(spt);
+		for (pteno = 0; pteno < NPTENTRIES; pteno++) {
+			pte_t pte = spt[pteno];
+			if (!(pte & PTE_P))
+				continue;
+			if (PGADDR(pdeno, pteno, 0) == (void *)(UXSTACKTOP - PGSIZE)) {
+				// The exception stack is never copy-on-write.
+				spt[pteno] = (pte | PTE_W) & ~PTE_COW;
+				continue;
+			}
+			dpt[pteno] = pte & (~0xFFF | PTE_SYSCALL);
+			page_incref(pa2page(PTE_ADDR(pte)));
+		}
+	}
+	return 0;
+}
+
+//
+// Give 'pgdir' a private, writable page table for the 4MB region
+// containing 'va', if that page table is shared since fork.
+//
+// If 'pgdir' is the last sharer, the page table is simply taken over.
+// Otherwise it is copied, and every page it maps gains a reference.
+// Writable pages are made copy-on-write, in the copy and in the
+// shared original, because after the split they are mapped by
+// two page tables.
+//
+// RETURNS:
+//   0 on success, or if the page table was not shared
+//   -E_NO_MEM, if the copy couldn't be allocated
+//
+int
+pgdir_unshare(pde_t *pgdir, const void *va)
+{
+	pde_t pde = pgdir[PDX(va)];
+	uint32_t pteno;
+
+	if (!(pde & PTE_P) || !(pde & PDE_PTSHARED))
+		return 0;
+
+	// Other sharers may be splitting the same page table on other
+	// CPUs, and the last one must know that it is the last.
+	spin_lock(&ptshare_lock);
+	struct PageInfo *oldpt = pa2page(PTE_ADDR(pde));
+	if (oldpt->pp_ref > 1) {
+		struct PageInfo *newpt = page_alloc(0);
+		if (!newpt) {
+			spin_unlock(&ptshare_lock);
+			return -E_NO_MEM;
+		}
+		pte_t *opt = page2kva(oldpt);
+		pte_t *npt = page2kva(newpt);
+
+		pt_mark_cow(opt);
+		for (pteno = 0; pteno < NPTENTRIES; pteno++) {
+			npt[pteno] = opt[pteno];
+			if (npt[pteno] & PTE_P)
+				page_incref(pa2page(PTE_ADDR(npt[pteno])));
+		}
+		newpt->pp_ref++;
+		__sync_fetch_and_sub(&oldpt->pp_ref, 1);
+		pde = page2pa(newpt) | (pde & 0xFFF);
+	}
+	spin_unlock(&ptshare_lock);
+
+	pgdir[PDX(va)] = (pde | PTE_W) & ~PDE_PTSHARED;
+	// The whole 4MB region changed.
+	if (thiscpu->cpu_cr3 == PADDR(pgdir))
+		lcr3(PADDR(pgdir));
+	return 0;
+}
+
+//
+// Drop pgdir's reference to the page table at index 'pdeno', if that
+// page table is shared since fork and other address spaces still map
+// it.  Used when tearing down an address space.
+//
+// RETURNS:
+//   true if the reference was dropped, false if the caller owns the
+//   page table and must free it and the pages it maps itself
+//
+bool
+pgdir_drop_shared(pde_t *pgdir, uint32_t pdeno)
+{
+	struct PageInfo *pt = pa2page(PTE_ADDR(pgdir[pdeno]));
+	bool dropped = false;
+
+	if (!(pgdir[pdeno] & PDE_PTSHARED))
+		return false;
+
+	spin_lock(&ptshare_lock);
+	if (pt->pp_ref > 1) {
+		pgdir[pdeno] = 0;
+		page_decref(pt);
+		dropped = true;
+	}
+	spin_unlock(&ptshare_lock);
+	return dropped;
+}
+
+//
+// Resolve a write to the copy-on-write page mapped at 'va' in 'pgdir':
+// map a private, writable copy of the page in its place.  If nobody
+// else maps the page any more, it is made writable without a copy.
+// A page table shared since fork is split first.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if no copy-on-write page is mapped at 'va'
+//   -E_NO_MEM, if a page or page table couldn't be allocated
+//
+int
+page_cow_break(pde_t *pgdir, void *va)
+{
+	pte_t *pte;
+	struct PageInfo *pp;
+
+	va = ROUNDDOWN(va, PGSIZE);
+	pp = page_lookup(pgdir, va, &pte);
+	if (!pp || !(*pte & PTE_COW))
+		return -E_INVAL;
+	if (pgdir_unshare(pgdir, va) < 0)
+		return -E_NO_MEM;
+	pp = page_lookup(pgdir, va, &pte);
+
+	int perm = (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W;
+	if (pp->pp_ref == 1) {
+		*pte = PTE_ADDR(*pte) | perm;
+		tlb_invalidate(pgdir, va);
+		return 0;
+	}
+
+	struct PageInfo *copy = page_alloc(0);
+	if (!copy)
+		return -E_NO_MEM;
+	memcpy(page2kva(copy), page2kva(pp), PGSIZE);
+	// Cannot fail: the page table exists and is not shared.
+	return page_insert(pgdir, copy, va, perm);
 }
 
 //
 // Invalidate a TLB entry, but only if the page tables being
 // edited are the ones currently in use by the processor.
+// Other CPUs running on 'pgdir' are flushed by tlb_shootdown.
 //
 void
 tlb_invalidate(pde_t *pgdir, void *va)
 {
 	// Flush the entry only if we're modifying the current address space.
-	if (!curenv || curenv->env_pgdir == pgdir)
-		invlpg(va);
+	if (!curenv || curenv->env_pgdir == pgdir) {
+		if (thiscpu->cpu_tlb_defer)
+			thiscpu->cpu_tlb_pending = true;
+		else
+			invlpg(va);
+	}
+	if (ncpu > 1) {
+		if (thiscpu->cpu_tlb_defer)
+			tlb_defer_shootdown(pgdir);
+		else
+			tlb_shootdown(pgdir);
+	}
+}
+
+//
+// Flush the TLB of every other CPU that has 'pgdir' loaded, and wait
+// until they all have, since the caller may free the unmapped pages
+// next.  The page syscalls change the address spaces of other envs,
+// which may be running on other CPUs at the time.
+//
+// A CPU is interrupted with IRQ_TLBFLUSH.  The interrupt waits while
+// the CPU is in the kernel, which may be spinning for a lock that we
+// hold, so spinning CPUs also look for a flush with tlb_shootdown_poll.
+//
+void
+tlb_shootdown(pde_t *pgdir)
+{
+	physaddr_t pa = PADDR(pgdir);
+	struct CpuInfo *c;
+
+	// The mappings must be changed before cpu_cr3 is looked at:
+	// a CPU that loads 'pgdir' after this sees the new mappings.
+	__sync_synchronize();
+	for (c = cpus; c < cpus + ncpu; c++) {
+		if (c == thiscpu || c->cpu_cr3 != pa)
+			continue;
+		c->cpu_tlb_shoot = true;
+		lapic_ipi_cpu(c->cpu_id, IRQ_OFFSET + IRQ_TLBFLUSH);
+	}
+	for (c = cpus; c < cpus + ncpu; c++)
+		while (c->cpu_tlb_shoot) {
+			// Two CPUs may be shooting at each other.
+			tlb_shootdown_poll();
+			asm volatile ("pause");
+		}
+}
+
+//
+// Flush this CPU's TLB if another CPU asked for it.
+//
+void
+tlb_shootdown_poll(void)
+{
+	if (thiscpu->cpu_tlb_shoot) {
+		lcr3(rcr3());
+		thiscpu->cpu_tlb_shoot = false;
+	}
+}
+
+//
+// Between tlb_defer_begin and tlb_defer_end, tlb_invalidate only notes
+// that the TLB is stale and which address spaces other CPUs must flush;
+// tlb_defer_end then flushes it all at once, with one shootdown per
+// address space.  Used to apply many mapping changes with a single TLB
+// flush.  The caller must not touch the changed user mappings in
+// between.  The deferral is per CPU.
+//
+// Pages unmapped in between may still be in some TLB, so page_remove
+// hands them to tlb_page_decref, which holds on to them until the flush.
+// If a CPU runs out of room for address spaces or pages, it flushes
+// early.
+//
+void
+tlb_defer_begin(void)
+{
+	thiscpu->cpu_tlb_defer++;
+}
+
+void
+tlb_defer_end(void)
+{
+	assert(thiscpu->cpu_tlb_defer > 0);
+	if (--thiscpu->cpu_tlb_defer == 0)
+		tlb_defer_flush();
+}
+
+//
+// Do the TLB flushes deferred so far, then drop the pages held back
+// for them.
+//
+static void
+tlb_defer_flush(void)
+{
+	struct CpuInfo *c = thiscpu;
+	int i;
+
+	if (c->cpu_tlb_pending) {
+		c->cpu_tlb_pending = false;
+		lcr3(rcr3());
+	}
+	for (i = 0; i < c->cpu_tlb_nshoot; i++)
+		tlb_shootdown(c->cpu_tlb_shoot_pgdirs[i]);
+	c->cpu_tlb_nshoot = 0;
+	for (i = 0; i < c->cpu_tlb_nfree; i++)
+		page_decref(c->cpu_tlb_free[i]);
+	c->cpu_tlb_nfree = 0;
+}
+
+//
+// Note that other CPUs running on 'pgdir' must flush their TLBs
+// at tlb_defer_end.
+//
+static void
+tlb_defer_shootdown(pde_t *pgdir)
+{
+	struct CpuInfo *c = thiscpu;
+	int i;
+
+	for (i = 0; i < c->cpu_tlb_nshoot; i++)
+		if (c->cpu_tlb_shoot_pgdirs[i] == pgdir)
+			return;
+	if (c->cpu_tlb_nshoot == TLB_DEFER_NPGDIR)
+		tlb_defer_flush();
+	c->cpu_tlb_shoot_pgdirs[c->cpu_tlb_nshoot++] = pgdir;
+}
+
+//
+// Drop a reference to a page that was just unmapped and passed to
+// tlb_invalidate.  Within tlb_defer_begin/tlb_defer_end the page
+// is released only after the deferred flushes.
+//
+static void
+tlb_page_decref(struct PageInfo *pp)
+{
+	struct CpuInfo *c = thiscpu;
+
+	if (!c->cpu_tlb_defer) {
+		page_decref(pp);
+		return;
+	}
+	if (c->cpu_tlb_nfree == TLB_DEFER_NPAGE)
+		tlb_defer_flush();
+	c->cpu_tlb_free[c->cpu_tlb_nfree++] = pp;
 }
 
 //
@@ -702,7 +1586,15 @@ mmio_map_region(physaddr_t pa, size_t size)
 	// Hint: The staff solution uses boot_map_region.
 	//
 	// Your code here:
-	panic("mmio_map_region not implemented");
+	size = ROUNDUP(pa + size, PGSIZE) - ROUNDDOWN(pa, PGSIZE);
+	pa = ROUNDDOWN(pa, PGSIZE);
+	if (base + size > MMIOLIM || base + size < base)
+		panic("mmio_map_region: out of MMIO space");
+
+	void *va = (void *)base;
+	boot_map_region(kern_pgdir, base, size, pa, PTE_PCD | PTE_PWT | PTE_W | PTE_G);
+	base += size;
+	return va;
 }
 
 static uintptr_t user_mem_check_addr;
@@ -725,8 +1617,22 @@ static uintptr_t user_mem_check_addr;
 // Returns 0 if the user program can access this range of addresses,
 // and -E_FAULT otherwise.
 //
+// Takes env's lock, so the caller must not hold it.
+//
 int
 user_mem_check(struct Env *env, const void *va, size_t len, int perm)
+{
+	env_lock(env);
+	int r = user_mem_check_locked(env, va, len, perm);
+	env_unlock(env);
+	return r;
+}
+
+//
+// Like user_mem_check, for callers that already hold env's lock.
+//
+int
+user_mem_check_locked(struct Env *env, const void *va, size_t len, int perm)
 {
 	// LAB 8: Your code here.
 	void* va_pg_align = (void*)ROUNDDOWN(va, PGSIZE);
@@ -954,9 +1860,15 @@ check_kern_pgdir(void)
 		assert(check_va2pa(pgdir, KERNBASE + i) == i);
 
 	// check kernel stack
-	for (i = 0; i < KSTKSIZE; i += PGSIZE)
-		assert(check_va2pa(pgdir, KSTACKTOP - KSTKSIZE + i) == PADDR(bootstack) + i);
-	assert(check_va2pa(pgdir, KSTACKTOP - PTSIZE) == ~0);
+	// (updated in lab 4 to check per-CPU kernel stacks)
+	for (n = 0; n < NCPU; n++) {
+		uint32_t base = KSTACKTOP - (KSTKSIZE + KSTKGAP) * (n + 1);
+		for (i = 0; i < KSTKSIZE; i += PGSIZE)
+			assert(check_va2pa(pgdir, base + KSTKGAP + i)
+				== PADDR(percpu_kstacks[n]) + i);
+		for (i = 0; i < KSTKGAP; i += PGSIZE)
+			assert(check_va2pa(pgdir, base + i) == ~0);
+	}
 
 	// check PDE permissions
 	for (i = 0; i < NPDENTRIES; i++) {
@@ -993,6 +1905,8 @@ check_va2pa(pde_t *pgdir, uintptr_t va)
 	pgdir = &pgdir[PDX(va)];
 	if (!(*pgdir & PTE_P))
 		return ~0;
+	if (*pgdir & PTE_PS)
+		return PTE_ADDR(*pgdir) + (va & (PTSIZE - PGSIZE));
 	p = (pte_t*) KADDR(PTE_ADDR(*pgdir));
 	if (!(p[PTX(va)] & PTE_P))
 		return ~0;
@@ -1189,3 +2103,31 @@ check_page_installed_pgdir(void)
 
 	cprintf("check_page_installed_pgdir() succeeded!\n");
 }
+
+// check the buddy allocator behind page_alloc_order
+static void
+check_buddy(void)
+{
+	struct PageInfo *pp;
+	int o;
+
+	// blocks are aligned to their size and zeroed on request
+	for (o = 1; o <= 4; o++) {
+		assert((pp = page_alloc_order(o, ALLOC_ZERO)));
+		assert(page2pa(pp) % (PGSIZE << o) == 0);
+		assert(*(uint32_t *) page2kva(pp + (1 << o) - 1) == 0);
+		page_free_order(pp, o);
+	}
+
+	// two free buddies are merged back into one block
+	spin_lock(&page_lock);
+	assert((pp = buddy_alloc(1)));
+	buddy_free(pp, 0);
+	assert(pp->pp_free && pp->pp_order == 0);
+	buddy_free(pp + 1, 0);
+	assert(pp->pp_free && pp->pp_order >= 1);
+	assert(!pp[1].pp_free);
+	spin_unlock(&page_lock);
+
+	cprintf("check_buddy() succeeded!\n");
+}
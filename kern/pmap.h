@@ -8,6 +8,8 @@
 
 #include <inc/memlayout.h>
 #include <inc/assert.h>
+#include <inc/x86.h>
+#include <kern/cpu.h>
 struct Env;
 
 extern char bootstacktop[], bootstack[];
@@ -46,26 +48,63 @@ _kaddr(const char *file, int line, physaddr_t pa)
 }
 
 
+// Largest block page_alloc_order can return: 2^10 pages, 4MB.
+#define PAGE_MAX_ORDER	10
+
+// Switch this CPU to the address space 'pgdir'.  Reloading CR3 flushes
+// the TLB, so it is skipped if 'pgdir' is loaded already, e.g. when
+// trap() returns to the env it came from.  Every change of CR3 must go
+// through here to keep cpu_cr3 right; a plain lcr3(rcr3()) only flushes.
+static inline void
+pgdir_load(pde_t *pgdir)
+{
+	physaddr_t pa = PADDR(pgdir);
+
+	if (thiscpu->cpu_cr3 != pa) {
+		thiscpu->cpu_cr3 = pa;
+		lcr3(pa);
+	}
+}
+
 enum {
 	// For page_alloc, zero the returned physical page.
 	ALLOC_ZERO = 1<<0,
 };
 
 void	mem_init(void);
+void	mem_init_pge(void);
 
 void	page_init(void);
 struct PageInfo *page_alloc(int alloc_flags);
 void	page_free(struct PageInfo *pp);
+struct PageInfo *page_alloc_order(int order, int alloc_flags);
+void	page_free_order(struct PageInfo *pp, int order);
+void	page_zero_idle(void);
 int	page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm);
-void	page_remove(pde_t *pgdir, void *va);
+int	page_insert_large(pde_t *pgdir, struct PageInfo *pp, void *va, int perm);
+int	page_remove(pde_t *pgdir, void *va);
 struct PageInfo *page_lookup(pde_t *pgdir, void *va, pte_t **pte_store);
 void	page_decref(struct PageInfo *pp);
+int	pgdir_fork(pde_t *dst, pde_t *src);
+int	pgdir_unshare(pde_t *pgdir, const void *va);
+bool	pgdir_drop_shared(pde_t *pgdir, uint32_t pdeno);
+int	page_cow_break(pde_t *pgdir, void *va);
+
+// Software PDE bit: the page table is shared read-only with other
+// address spaces since fork.  The page table page's pp_ref counts the
+// page directories that map it.  See pgdir_fork and pgdir_unshare.
+#define PDE_PTSHARED	0x200
 
 void	tlb_invalidate(pde_t *pgdir, void *va);
+void	tlb_shootdown(pde_t *pgdir);
+void	tlb_shootdown_poll(void);
+void	tlb_defer_begin(void);
+void	tlb_defer_end(void);
 
 void *	mmio_map_region(physaddr_t pa, size_t size);
 
 int	user_mem_check(struct Env *env, const void *va, size_t len, int perm);
+int	user_mem_check_locked(struct Env *env, const void *va, size_t len, int perm);
 void	user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
 
 static inline physaddr_t
@@ -88,6 +127,15 @@ page2kva(struct PageInfo *pp)
 	return KADDR(page2pa(pp));
 }
 
+// Take a reference to pp.  Pages can be shared between address spaces
+// that other CPUs change at the same time, so pp_ref is only ever
+// updated atomically.
+static inline void
+page_incref(struct PageInfo *pp)
+{
+	__sync_fetch_and_add(&pp->pp_ref, 1);
+}
+
 pte_t *pgdir_walk(pde_t *pgdir, const void *va, int create);
 
 #endif /* !JOS_KERN_PMAP_H */
@@ -4,7 +4,12 @@
 #include <inc/types.h>
 #include <inc/stdio.h>
 #include <inc/stdarg.h>
+#include <kern/spinlock.h>
 
+// Keeps lines printed by different CPUs from interleaving.
+static struct spinlock cons_lock = {
+	.name = "cons_lock"
+};
 
 static void
 putch(int ch, int *cnt)
@@ -16,9 +21,18 @@ putch(int ch, int *cnt)
 int
 vcprintf(const char *fmt, va_list ap)
 {
+	extern const char *panicstr;
 	int cnt = 0;
 
+	// Once the kernel is panicking this CPU may already hold the lock,
+	// and getting the message out matters more than keeping it tidy.
+	if (panicstr) {
+		vprintfmt((void*)putch, &cnt, fmt, ap);
+		return cnt;
+	}
+	spin_lock(&cons_lock);
 	vprintfmt((void*)putch, &cnt, fmt, ap);
+	spin_unlock(&cons_lock);
 	return cnt;
 }
 
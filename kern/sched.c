@@ -1,47 +1,324 @@
 #include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/vsyscall.h>
 #include <inc/x86.h>
 #include <kern/env.h>
 #include <kern/monitor.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
+#include <kern/spinlock.h>
+#include <kern/vsyscall.h>
 
+void sched_halt(void) __attribute__((noreturn));
 
-struct Taskstate cpu_ts;
-void sched_halt(void);
+// Runnable environments are kept in a binary min-heap over the env
+// array, so that queueing and dequeueing an env costs O(log n) and the
+// next env to run is always runq[0].  Envs are ordered by priority
+// level first: the scheduler always picks from the highest level that
+// has a runnable env.  The running environment is never on the heap.
+//
+// Within a level the CPU is shared in proportion to env_weight, in the
+// style of the Linux CFS: every env accumulates virtual runtime, which
+// is the CPU time it used scaled by NICE_0_WEIGHT / env_weight, and
+// the heap is ordered by env_vruntime within a level, so the env that
+// is furthest behind its fair share comes first.  Envs with equal
+// vruntime are taken in the order they were queued (env_rq_seq).
+static struct Env *runq[NENV];
+static uint32_t runq_len;
+static uint32_t runq_seq;
+
+// Monotonic lower bound of env_vruntime on each queue.  An env that
+// wakes up after sleeping is placed no earlier than this, so it cannot
+// monopolize the CPU to "catch up" on the time it spent blocked.
+static uint64_t runq_min_vruntime[NENVPRIO];
+
+// Number of environments that are ENV_RUNNABLE, ENV_RUNNING or ENV_DYING.
+// sched_halt uses it instead of scanning the whole envs array.
+static int32_t sched_nactive;
+
+// Protects the run queue, the fields above and every env_status.
+static struct spinlock sched_lock = {
+	.kind = SPINLOCK_MCS,
+	.name = "sched_lock"
+};
+
+// TSC value at which each CPU last charged its curenv for CPU time.
+static uint64_t sched_last_tsc[NCPU];
+
+#define NICE_0_WEIGHT	1024
+
+// Weight of each nice value, ENV_NICE_MIN first.  Neighbouring entries
+// differ by a factor of about 1.25, so one nice step moves roughly 10%
+// of CPU time between two competing environments.  Same table as Linux.
+static const uint32_t nice_to_weight[ENV_NICE_MAX - ENV_NICE_MIN + 1] = {
+	/* -20 */ 88761, 71755, 56483, 46273, 36291,
+	/* -15 */ 29154, 23254, 18705, 14949, 11916,
+	/* -10 */  9548,  7620,  6100,  4904,  3906,
+	/*  -5 */  3121,  2501,  1991,  1586,  1277,
+	/*   0 */  1024,   820,   655,   526,   423,
+	/*   5 */   335,   272,   215,   172,   137,
+	/*  10 */   110,    87,    70,    56,    45,
+	/*  15 */    36,    29,    23,    18,    15,
+};
+
+static bool
+status_is_active(unsigned status)
+{
+	return status == ENV_RUNNABLE || status == ENV_RUNNING ||
+	       status == ENV_DYING;
+}
+
+// Does a run before b?
+static bool
+runq_before(const struct Env *a, const struct Env *b)
+{
+	if (a->env_priority != b->env_priority)
+		return a->env_priority > b->env_priority;
+	if (a->env_vruntime != b->env_vruntime)
+		return a->env_vruntime < b->env_vruntime;
+	return (int32_t) (a->env_rq_seq - b->env_rq_seq) < 0;
+}
+
+static void
+runq_set(uint32_t i, struct Env *e)
+{
+	runq[i] = e;
+	e->env_rq_index = i;
+}
+
+// Move runq[i] towards the root until its parent runs before it.
+static void
+runq_sift_up(uint32_t i)
+{
+	struct Env *e = runq[i];
+
+	while (i > 0 && runq_before(e, runq[(i - 1) / 2])) {
+		runq_set(i, runq[(i - 1) / 2]);
+		i = (i - 1) / 2;
+	}
+	runq_set(i, e);
+}
+
+// Move runq[i] towards the leaves until it runs before its children.
+static void
+runq_sift_down(uint32_t i)
+{
+	struct Env *e = runq[i];
+	uint32_t child;
+
+	while ((child = 2 * i + 1) < runq_len) {
+		if (child + 1 < runq_len &&
+		    runq_before(runq[child + 1], runq[child]))
+			child++;
+		if (!runq_before(runq[child], e))
+			break;
+		runq_set(i, runq[child]);
+		i = child;
+	}
+	runq_set(i, e);
+}
+
+// Add e to the run queue.
+static void
+runq_push(struct Env *e)
+{
+	assert(runq_len < NENV);
+	e->env_rq_seq = runq_seq++;
+	runq[runq_len] = e;
+	runq_sift_up(runq_len++);
+}
+
+// Take e off the run queue.
+static void
+runq_remove(struct Env *e)
+{
+	uint32_t i = e->env_rq_index;
+	struct Env *last = runq[--runq_len];
+
+	assert(runq[i] == e);
+	if (last == e)
+		return;
+	runq[i] = last;
+	runq_sift_up(i);
+	runq_sift_down(last->env_rq_index);
+}
+
+// Return the env to run next, or NULL.
+static struct Env *
+runq_first(void)
+{
+	return runq_len ? runq[0] : NULL;
+}
+
+static void
+sched_set_status_locked(struct Env *e, unsigned status)
+{
+	uint32_t prio = e->env_priority;
+
+	// A zombie stays one until its own CPU frees it.  An env running
+	// on another CPU must not be queued as well, since a third CPU
+	// could then pick it up while it is still running.
+	if (e->env_status == ENV_DYING && status != ENV_FREE)
+		return;
+	if (e->env_status == ENV_RUNNING && e != curenv &&
+	    status == ENV_RUNNABLE)
+		return;
+
+	sched_nactive -= status_is_active(e->env_status);
+	if (e->env_status == ENV_RUNNABLE)
+		runq_remove(e);
+
+	// An env that is woken up or newly created starts from the
+	// current minimum instead of its stale vruntime.  IPC may switch
+	// to a blocked env directly, so this applies to ENV_RUNNING too.
+	if ((status == ENV_RUNNABLE || status == ENV_RUNNING) &&
+	    e->env_status != ENV_RUNNABLE && e->env_status != ENV_RUNNING &&
+	    e->env_vruntime < runq_min_vruntime[prio])
+		e->env_vruntime = runq_min_vruntime[prio];
+
+	// An env that starts running is normally the one furthest behind
+	// on its level, so the level's minimum vruntime can advance to it.
+	if (status == ENV_RUNNING && e->env_vruntime > runq_min_vruntime[prio])
+		runq_min_vruntime[prio] = e->env_vruntime;
+
+	e->env_status = status;
+
+	if (status == ENV_RUNNABLE)
+		runq_push(e);
+	sched_nactive += status_is_active(status);
+}
+
+// Change e's status, keeping the run queue up to date.
+// Every env_status transition of an allocated environment
+// must go through this function.
+void
+sched_set_status(struct Env *e, unsigned status)
+{
+	spin_lock(&sched_lock);
+	sched_set_status_locked(e, status);
+	spin_unlock(&sched_lock);
+}
+
+// Make sure no CPU starts running e, which is about to be destroyed.
+// Returns true if e is running on another CPU and has been marked
+// ENV_DYING instead, for that CPU to free it.  Otherwise e is taken
+// off the run queue and the caller may free it right away.
+bool
+sched_make_zombie(struct Env *e)
+{
+	bool zombie = false;
+
+	spin_lock(&sched_lock);
+	if (e->env_status == ENV_RUNNING && e != curenv) {
+		sched_set_status_locked(e, ENV_DYING);
+		zombie = true;
+	} else if (e->env_status == ENV_RUNNABLE) {
+		sched_set_status_locked(e, ENV_NOT_RUNNABLE);
+	}
+	spin_unlock(&sched_lock);
+	return zombie;
+}
+
+// Move e to another priority level.
+void
+sched_set_priority(struct Env *e, uint32_t prio)
+{
+	assert(prio < NENVPRIO);
+	spin_lock(&sched_lock);
+	if (e->env_status == ENV_RUNNABLE) {
+		runq_remove(e);
+		e->env_priority = prio;
+		if (e->env_vruntime < runq_min_vruntime[prio])
+			e->env_vruntime = runq_min_vruntime[prio];
+		runq_push(e);
+	} else {
+		e->env_priority = prio;
+	}
+	spin_unlock(&sched_lock);
+}
+
+// Set e's nice value and the weight derived from it.
+// Returns -E_INVAL if nice is out of range.
+int
+sched_set_nice(struct Env *e, int32_t nice)
+{
+	if (nice < ENV_NICE_MIN || nice > ENV_NICE_MAX)
+		return -E_INVAL;
+	spin_lock(&sched_lock);
+	e->env_nice = nice;
+	// Weight affects only future charges, not e's place in the queue.
+	e->env_weight = nice_to_weight[nice - ENV_NICE_MIN];
+	spin_unlock(&sched_lock);
+	return 0;
+}
+
+// Charge curenv for the CPU time it has used since the last call
+// and restart the accounting interval.
+void
+sched_charge(void)
+{
+	uint64_t now = read_tsc();
+	uint64_t delta = now - sched_last_tsc[cpunum()];
+
+	sched_last_tsc[cpunum()] = now;
+	if (curenv == NULL || curenv->env_status == ENV_FREE)
+		return;
+	curenv->env_cputime += delta;
+	curenv->env_vruntime += delta * NICE_0_WEIGHT / curenv->env_weight;
+}
 
 // Choose a user environment to run and run it.
 void
 sched_yield(void)
 {
-	// Implement simple round-robin scheduling.
+	// Run the environment with the smallest virtual runtime
+	// within the highest runnable priority level.
 	//
-	// Search through 'envs' for an ENV_RUNNABLE environment in
-	// circular fashion starting just after the env was
-	// last running.  Switch to the first such environment found.
-	//
-	// If no envs are runnable, but the environment previously
-	// running is still ENV_RUNNING, it's okay to
-	// choose that environment.
+	// The current environment, if it is still ENV_RUNNING, is first
+	// charged for the time it just used and then put back on its
+	// queue, so it keeps the CPU only while it is still the furthest
+	// behind its fair share.
 	//
 	// If there are no runnable environments,
 	// simply drop through to the code
 	// below to halt the cpu.
-	
-	// find previously run env
-	int32_t curindex = (curenv == NULL) ? -1 : curenv - envs;
-	
-	// do NENV loops, searching for running env modulo NENV,
-	// start search right after current ENV_RUNNING
-	for (int32_t i = 0; i < NENV; i++)
-	{
-		curindex += 1;
-		int32_t index = curindex % NENV;
-		if (envs[index].env_status == ENV_RUNNABLE
-			|| envs[index].env_status == ENV_RUNNING)
-		{
-
-			env_run(&envs[index]);
-		}
+	// The choice is made under sched_lock and the chosen env is
+	// marked ENV_RUNNING before the lock is dropped, so no other
+	// CPU can choose it too.
+	struct Env *e;
+
+	// A zombie that got here without passing through trap()'s check.
+	if (curenv && curenv->env_status == ENV_DYING) {
+		if (!kernel_locked())
+			lock_kernel();
+		env_free(curenv);
+		curenv = NULL;
 	}
 
+	sched_charge();
+	spin_lock(&sched_lock);
+	if (curenv && curenv->env_status == ENV_RUNNING)
+		sched_set_status_locked(curenv, ENV_RUNNABLE);
+
+	e = runq_first();
+	if (e)
+		sched_set_status_locked(e, ENV_RUNNING);
+#ifndef CONFIG_KSPACE
+	// Once curenv is queued and the lock is dropped, another CPU may
+	// run it, or free it, so stop using its address space first.
+	// Switching straight to the chosen env's address space makes the
+	// switch in env_run free, and costs nothing if curenv runs again.
+	if (curenv)
+		pgdir_load(e ? e->env_pgdir : kern_pgdir);
+#endif
+	// For the same reason env_run must not look at curenv again: it
+	// could see it ENV_RUNNING on another CPU and queue it a second
+	// time.  This CPU is done with it.
+	curenv = NULL;
+	spin_unlock(&sched_lock);
+	if (e)
+		env_run(e);
+
 	// sched_halt never returns
 	sched_halt();
 }
@@ -52,24 +329,34 @@ sched_yield(void)
 void
 sched_halt(void)
 {
-	int i;
-
 	// For debugging and testing purposes, if there are no runnable
 	// environments in the system, then drop into the kernel monitor.
-	for (i = 0; i < NENV; i++) {
-		if ((envs[i].env_status == ENV_RUNNABLE ||
-		     envs[i].env_status == ENV_RUNNING ||
-		     envs[i].env_status == ENV_DYING))
-			break;
-	}
-	if (i == NENV) {
+	if (sched_nactive == 0) {
+		if (!kernel_locked())
+			lock_kernel();
 		cprintf("No runnable environments in the system!\n");
 		while (1)
 			monitor(NULL);
 	}
 
-	// Mark that no environment is running on CPU
+	// Mark that no environment is running on this CPU
 	curenv = NULL;
+	vsys[VSYS_cpu_envid + cpunum()] = 0;
+#ifndef CONFIG_KSPACE
+	pgdir_load(kern_pgdir);
+#endif
+
+	// Mark that this CPU is in the HALT state, so that when
+	// timer interrupts come in, we know we should re-acquire the
+	// big kernel lock
+	xchg(&thiscpu->cpu_status, CPU_HALTED);
+
+	// Release the big kernel lock as if we were "leaving" the kernel
+	if (kernel_locked())
+		unlock_kernel();
+
+	// Use the idle time to zero pages for page_alloc(ALLOC_ZERO).
+	page_zero_idle();
 
 	// Reset stack pointer, enable interrupts and then halt.
 	asm volatile (
@@ -78,7 +365,14 @@ sched_halt(void)
 		"pushl $0\n"
 		"pushl $0\n"
 		"sti\n"
+		"1:\n"
 		"hlt\n"
-	: : "a" (cpu_ts.ts_esp0));
+		"jmp 1b\n"
+	: : "a" (thiscpu->cpu_ts.ts_esp0));
+
+	// The next interrupt enters trap() on a fresh stack,
+	// so we never get here.
+	for (;;)
+		;
 }
 
@@ -6,7 +6,17 @@
 # error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/types.h>
+
+struct Env;
+
 // This function does not return.
 void sched_yield(void) __attribute__((noreturn));
 
+void sched_set_status(struct Env *e, unsigned status);
+bool sched_make_zombie(struct Env *e);
+void sched_set_priority(struct Env *e, uint32_t prio);
+int sched_set_nice(struct Env *e, int32_t nice);
+void sched_charge(void);
+
 #endif	// !JOS_KERN_SCHED_H
@@ -7,15 +7,31 @@
 #include <inc/string.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/pmap.h>
 #include <kern/kdebug.h>
 
 // The big kernel lock
 struct spinlock kernel_lock = {
-#ifdef DEBUG_SPINLOCK
+	.kind = SPINLOCK_MCS,
 	.name = "kernel_lock"
-#endif
 };
 
+struct spinlock *spinlock_stats;
+
+// MCS queue node.  A CPU waiting for an MCS lock spins on the
+// 'waiting' field of its own node until its predecessor in the
+// queue clears it.
+struct mcs_node {
+	struct mcs_node *volatile next;
+	volatile unsigned waiting;
+	bool in_use;
+} __attribute__((aligned(64)));
+
+// How many MCS locks a CPU may hold (or wait for) at once.
+#define NMCSNODE 8
+
+static struct mcs_node mcs_nodes[NCPU][NMCSNODE];
+
 #ifdef DEBUG_SPINLOCK
 // Record the current call stack in pcs[] by following the %ebp chain.
 static void
@@ -39,19 +55,108 @@ get_caller_pcs(uint32_t pcs[])
 static int
 holding(struct spinlock *lock)
 {
-	return lock->locked;
+	if (lock->kind == SPINLOCK_MCS)
+		return lock->tail != NULL && lock->cpu == thiscpu;
+	return lock->next != lock->owner && lock->cpu == thiscpu;
 }
 #endif
 
 void
 __spin_initlock(struct spinlock *lk, char *name)
 {
-	lk->locked = 0;
-#ifdef DEBUG_SPINLOCK
+	lk->kind = SPINLOCK_TICKET;
 	lk->name = name;
+	lk->next = lk->owner = 0;
+	lk->tail = lk->holder = NULL;
+#ifdef DEBUG_SPINLOCK
+	lk->cpu = 0;
 #endif
 }
 
+void
+__mcs_initlock(struct spinlock *lk, char *name)
+{
+	__spin_initlock(lk, name);
+	lk->kind = SPINLOCK_MCS;
+}
+
+// Wait for a ticket lock.  Returns true if we had to wait.
+static bool
+ticket_lock(struct spinlock *lk)
+{
+	unsigned ticket = __sync_fetch_and_add(&lk->next, 1);
+
+	if (lk->owner == ticket)
+		return false;
+	// The holder may be waiting for us to flush our TLB.
+	while (lk->owner != ticket) {
+		tlb_shootdown_poll();
+		asm volatile ("pause");
+	}
+	return true;
+}
+
+static void
+ticket_unlock(struct spinlock *lk)
+{
+	// The locked add serializes, so that loads and stores in the
+	// critical section are not reordered after the release.
+	__sync_fetch_and_add(&lk->owner, 1);
+}
+
+// Join the queue of an MCS lock and wait for our turn.
+// Returns true if we had to wait.
+static bool
+mcs_lock(struct spinlock *lk)
+{
+	struct mcs_node *node = mcs_nodes[cpunum()];
+	struct mcs_node *pred;
+	int i;
+
+	for (i = 0; i < NMCSNODE && node[i].in_use; i++)
+		;
+	if (i == NMCSNODE)
+		panic("spin_lock %s: too many MCS locks held", lk->name);
+	node += i;
+	node->in_use = true;
+	node->next = NULL;
+	node->waiting = 1;
+
+	// xchg is atomic and serializes, like in the old xchg lock.
+	pred = (struct mcs_node *)xchg((volatile uint32_t *)&lk->tail,
+				       (uint32_t)node);
+	if (pred) {
+		pred->next = node;
+		// The holder may be waiting for us to flush our TLB.
+		while (node->waiting) {
+			tlb_shootdown_poll();
+			asm volatile ("pause");
+		}
+	}
+	lk->holder = node;
+	return pred != NULL;
+}
+
+static void
+mcs_unlock(struct spinlock *lk)
+{
+	struct mcs_node *node = lk->holder;
+
+	if (!node->next) {
+		// No one is queued behind us, unless someone is
+		// in the middle of joining the queue right now.
+		if (__sync_bool_compare_and_swap(&lk->tail, node, NULL))
+			goto out;
+		while (!node->next)
+			asm volatile ("pause");
+	}
+	// Hand the lock over; this store releases it.
+	asm volatile ("" : : : "memory");
+	node->next->waiting = 0;
+    out:
+	node->in_use = false;
+}
+
 // Acquire the lock.
 // Loops (spins) until the lock is acquired.
 // Holding a lock for a long time may cause
@@ -59,19 +164,40 @@ __spin_initlock(struct spinlock *lk, char *name)
 void
 spin_lock(struct spinlock *lk)
 {
+	uint64_t start;
+	bool contended;
+
 #ifdef DEBUG_SPINLOCK
 	if (holding(lk))
 		panic("Cannot acquire %s: already holding", lk->name);
 #endif
 
-	// The xchg is atomic.
-	// It also serializes, so that reads after acquire are not
-	// reordered before it.
-	while (xchg(&lk->locked, 1) != 0)
-		asm volatile ("pause");
+	// Only waits are charged to spin_cycles, but the clock starts
+	// before the atomic operation that found the lock busy.
+	start = read_tsc();
+	if (lk->kind == SPINLOCK_MCS)
+		contended = mcs_lock(lk);
+	else
+		contended = ticket_lock(lk);
+
+	// We hold the lock, so the counters are ours to update.
+	lk->nacquire++;
+	if (contended) {
+		lk->spin_cycles += read_tsc() - start;
+		lk->ncontended++;
+		if (!lk->stat_listed) {
+			// First contention: make the lock visible to lockstat.
+			lk->stat_listed = true;
+			do
+				lk->stat_next = spinlock_stats;
+			while (!__sync_bool_compare_and_swap(&spinlock_stats,
+							     lk->stat_next, lk));
+		}
+	}
 
 	// Record info about lock acquisition for debugging.
 #ifdef DEBUG_SPINLOCK
+	lk->cpu = thiscpu;
 	get_caller_pcs(lk->pcs);
 #endif
 }
@@ -86,7 +212,9 @@ spin_unlock(struct spinlock *lk)
 		uint32_t pcs[10];
 		// Nab the acquiring EIP chain before it gets released
 		memmove(pcs, lk->pcs, sizeof pcs);
-		cprintf("Cannot release %s\nAcquired at:", lk->name);
+		cprintf("Cannot release %s: CPU %d holds it, not CPU %d\n"
+			"Acquired at:", lk->name,
+			lk->cpu ? lk->cpu->cpu_id : -1, cpunum());
 		for (i = 0; i < 10 && pcs[i]; i++) {
 			struct Eipdebuginfo info;
 			if (debuginfo_eip(pcs[i], &info) >= 0)
@@ -101,17 +229,11 @@ spin_unlock(struct spinlock *lk)
 	}
 
 	lk->pcs[0] = 0;
+	lk->cpu = 0;
 #endif
 
-	// The xchg serializes, so that reads before release are 
-	// not reordered after it.  The 1996 PentiumPro manual (Volume 3,
-	// 7.2) says reads can be carried out speculatively and in
-	// any order, which implies we need to serialize here.
-	// But the 2007 Intel 64 Architecture Memory Ordering White
-	// Paper says that Intel 64 and IA-32 will not move a load
-	// after a store. So lock->locked = 0 would work here.
-	// The xchg being asm volatile ensures gcc emits it after
-	// the above assignments (and after the critical section).
-	xchg(&lk->locked, 0);
+	if (lk->kind == SPINLOCK_MCS)
+		mcs_unlock(lk);
+	else
+		ticket_unlock(lk);
 }
-
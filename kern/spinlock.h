@@ -2,39 +2,100 @@
 #define JOS_INC_SPINLOCK_H
 
 #include <inc/types.h>
+#include <kern/cpu.h>
 
 // Comment this to disable spinlock debugging
 //#define DEBUG_SPINLOCK
 
+// Kinds of lock.  Both are fair: CPUs get the lock in the order they
+// asked for it.  A ticket lock is a pair of counters, so every waiter
+// spins on the same cache line; an MCS lock keeps a queue of waiters,
+// each spinning on its own per-CPU node, and scales better on the
+// heavily contended locks.  A zeroed struct spinlock is an unlocked
+// ticket lock.
+#define SPINLOCK_TICKET	0
+#define SPINLOCK_MCS	1
+
+struct mcs_node;
+
 // Mutual exclusion lock.
 struct spinlock {
-	unsigned locked;       // Is the lock held?
+	unsigned kind;		// SPINLOCK_TICKET or SPINLOCK_MCS
+	char *name;		// Name of lock.
+
+	// Ticket lock: the lock is free iff next == owner.
+	volatile unsigned next;		// Next ticket to hand out
+	volatile unsigned owner;	// Ticket that holds the lock
+
+	// MCS lock: the lock is free iff tail is NULL.
+	struct mcs_node *volatile tail;	// Last CPU in the queue
+	struct mcs_node *holder;	// Node of the CPU holding the lock
+
+	// Statistics, only ever updated by the CPU that holds the lock.
+	uint64_t nacquire;	// Number of acquisitions
+	uint64_t ncontended;	// Acquisitions that had to wait
+	uint64_t spin_cycles;	// TSC cycles spent waiting
+	struct spinlock *stat_next;	// Next lock in spinlock_stats
+	bool stat_listed;		// Is the lock on spinlock_stats?
 
 #ifdef DEBUG_SPINLOCK
 	// For debugging:
-	char *name;            // Name of lock.
+	struct CpuInfo *cpu;   // The CPU holding the lock.
 	uintptr_t pcs[10];     // The call stack (an array of program counters)
 	                       // that locked the lock.
 #endif
 };
 
+// List of the locks that have been contended at least once,
+// linked through stat_next, for the monitor's lockstat command.
+extern struct spinlock *spinlock_stats;
+
 void __spin_initlock(struct spinlock *lk, char *name);
+void __mcs_initlock(struct spinlock *lk, char *name);
 void spin_lock(struct spinlock *lk);
 void spin_unlock(struct spinlock *lk);
 
 #define spin_initlock(lock)   __spin_initlock(lock, #lock)
+#define mcs_initlock(lock)    __mcs_initlock(lock, #lock)
 
+// Lock order.  A CPU that holds one of these locks may only acquire
+// locks that come after it in this list, never one before it:
+//
+//	kernel_lock	the big kernel lock; serializes every trap except
+//			the system calls that syscall_is_parallel() lets
+//			run without it
+//	env locks	env_lock(e), one per env: e's address space and
+//			its IPC state.  Two env locks are always taken
+//			in envs[] order, see env_lock_pair()
+//	ptshare_lock	page tables shared since fork (pmap.c)
+//	env_table_lock	env_free_list and env id generation (env.c)
+//	sched_lock	run queue and env_status (sched.c)
+//	page_lock	the free page lists (pmap.c)
+//	zero_lock	the pool of pre-zeroed pages (pmap.c)
+//	cons_lock	console output (printf.c)
+//
+// Page reference counts are updated with atomic instructions and
+// need no lock of their own.
 extern struct spinlock kernel_lock;
 
 static inline void
 lock_kernel(void)
 {
 	spin_lock(&kernel_lock);
+	thiscpu->cpu_kernel_locked = true;
+}
+
+// Does this CPU hold the big kernel lock?
+static inline bool
+kernel_locked(void)
+{
+	return thiscpu->cpu_kernel_locked;
 }
 
 static inline void
 unlock_kernel(void)
 {
+	thiscpu->cpu_kernel_locked = false;
 	spin_unlock(&kernel_lock);
 
 	// Normally we wouldn't need to do this, but QEMU only runs
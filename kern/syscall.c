@@ -4,6 +4,7 @@
 #include <inc/error.h>
 #include <inc/string.h>
 #include <inc/assert.h>
+#include <inc/vsyscall.h>
 
 #include <kern/env.h>
 #include <kern/pmap.h>
@@ -11,7 +12,7 @@
 #include <kern/syscall.h>
 #include <kern/console.h>
 #include <kern/sched.h>
-#include <kern/kclock.h>
+#include <kern/vsyscall.h>
 
 // Print a string to the system console.
 // The string is exactly 'len' characters long.
@@ -24,8 +25,12 @@ sys_cputs(const char *s, size_t len)
 
 	// LAB 8: Your code here.
 
-	// Print the string supplied by the user.
-	cprintf("%.*s", len, s);
+	// Print the string supplied by the user.  Our own lock keeps our
+	// parent from unmapping it on another CPU while it is printed.
+	env_lock(curenv);
+	if (user_mem_check_locked(curenv, s, len, PTE_U) == 0)
+		cprintf("%.*s", len, s);
+	env_unlock(curenv);
 }
 
 // Read a character from the system console without blocking.
@@ -93,13 +98,76 @@ sys_exofork(void)
 		return retval;
 	}
 
-	newenv->env_status = ENV_NOT_RUNNABLE;
+	sched_set_status(newenv, ENV_NOT_RUNNABLE);
+	sched_set_nice(newenv, curenv->env_nice);
 	newenv->env_tf = curenv->env_tf;
 	newenv->env_tf.tf_regs.reg_eax = 0;
 
 	return newenv->env_id;
 }
 
+// Fork the current environment entirely in the kernel.  The child gets
+// a copy-on-write copy of the parent's address space below UTOP (see
+// pgdir_fork), a fresh zeroed user exception stack if the parent has
+// one, the parent's page fault upcall, and the parent's registers with
+// eax set to 0.  Copy-on-write faults are resolved by the user-level
+// page fault handler as before, so the caller must have installed one.
+// The child is runnable when this returns.
+//
+// Returns envid of new environment, or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_fork(void)
+{
+	struct Env *child = NULL;
+	struct PageInfo *pp;
+	int32_t retval;
+
+	retval = env_alloc(&child, curenv->env_id);
+	if (retval < 0) {
+		return retval;
+	}
+	sched_set_status(child, ENV_NOT_RUNNABLE);
+	sched_set_nice(child, curenv->env_nice);
+	child->env_tf = curenv->env_tf;
+	child->env_tf.tf_regs.reg_eax = 0;
+	child->env_pgfault_upcall = curenv->env_pgfault_upcall;
+	child->env_kcow = curenv->env_kcow;
+
+	// Nobody but us can reach the child yet, but our own parent
+	// may be changing our address space on another CPU.
+	env_lock(curenv);
+	retval = pgdir_fork(child->env_pgdir, curenv->env_pgdir);
+	env_unlock(curenv);
+	// Parent PTEs may have lost PTE_W: flush the whole TLB at once.
+	lcr3(PADDR(curenv->env_pgdir));
+	if (retval < 0) {
+		goto fail;
+	}
+
+	if (page_lookup(curenv->env_pgdir, (void *)(UXSTACKTOP - PGSIZE), NULL)) {
+		retval = -E_NO_MEM;
+		if (!(pp = page_alloc(ALLOC_ZERO))) {
+			goto fail;
+		}
+		retval = page_insert(child->env_pgdir, pp,
+				     (void *)(UXSTACKTOP - PGSIZE),
+				     PTE_P | PTE_U | PTE_W);
+		if (retval < 0) {
+			page_free(pp);
+			goto fail;
+		}
+	}
+
+	sched_set_status(child, ENV_RUNNABLE);
+	return child->env_id;
+
+fail:
+	env_free(child);
+	return retval;
+}
+
 // Set envid's env_status to status, which must be ENV_RUNNABLE
 // or ENV_NOT_RUNNABLE.
 //
@@ -127,10 +195,65 @@ sys_env_set_status(envid_t envid, int status)
 		return retval;
 	}
 
-	e->env_status = status;
+	// A zombie waits for its CPU to free it.  An env that is
+	// running on another CPU must not be queued as well, or a
+	// third CPU could pick it up while it is still running.
+	if (e->env_status == ENV_DYING)
+		return -E_BAD_ENV;
+	if (e->env_status == ENV_RUNNING && e != curenv &&
+	    status == ENV_RUNNABLE)
+		return 0;
+
+	sched_set_status(e, status);
 	return 0;
 }
 
+// Choose whether write faults on envid's PTE_COW pages are resolved by
+// the kernel ('enable' != 0) or passed to the page fault upcall.
+// The kernel copies the page, or just makes it writable if no other
+// address space maps it.  Envs created by sys_fork inherit the choice.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+static int
+sys_env_set_kcow(envid_t envid, int enable)
+{
+	struct Env *e = NULL;
+	int32_t retval = envid2env(envid, &e, 1);
+	if (retval < 0) {
+		return retval;
+	}
+
+	e->env_kcow = (enable != 0);
+	return 0;
+}
+
+// Set envid's nice value, which determines its share of the CPU
+// relative to other environments of the same priority level.
+// Lower values get more CPU time.  Only system environments may
+// use negative nice values.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if nice is out of range or not allowed for the caller.
+static int
+sys_env_set_nice(envid_t envid, int nice)
+{
+	if (nice < 0 && curenv->env_type == ENV_TYPE_USER) {
+		return -E_INVAL;
+	}
+
+	struct Env *e = NULL;
+	int32_t retval = envid2env(envid, &e, 1);
+	if (retval < 0) {
+		return retval;
+	}
+
+	return sched_set_nice(e, nice);
+}
+
 // Set envid's trap frame to 'tf'.
 // tf is modified to make sure that user environments always run at code
 // protection level 3 (CPL 3) with interrupts enabled.
@@ -189,6 +312,41 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 	return 0;
 }
 
+// The PTE_PS case of sys_page_alloc: map 4MB of zeroed, physically
+// contiguous memory at the 4MB-aligned 'va' with a single 4MB page,
+// to save page tables and TLB entries on large regions.  Nothing may
+// be mapped in [va, va + 4MB) yet.  Only PTE_W and PTE_SHARE may be
+// given besides PTE_U and PTE_P; the other PTE_AVAIL bits mean something
+// else in a page directory entry.  The pages cannot be passed on with
+// sys_page_map or IPC, but fork shares them with the child.
+static int
+sys_page_alloc_large(envid_t envid, void *va, int perm)
+{
+	if ((uintptr_t)va % PTSIZE != 0 ||
+	    PDX(va) == PDX(UXSTACKTOP - PGSIZE) ||
+	    (perm & ~(PTE_P | PTE_U | PTE_W | PTE_SHARE)) != 0) {
+		return -E_INVAL;
+	}
+
+	struct PageInfo *pi = page_alloc_order(PAGE_MAX_ORDER, ALLOC_ZERO);
+	if (!pi) {
+		return -E_NO_MEM;
+	}
+	struct Env *e = NULL;
+	int32_t retval = envid2env_lock(envid, &e, 1);
+	if (retval < 0) {
+		page_free_order(pi, PAGE_MAX_ORDER);
+		return retval;
+	}
+	retval = page_insert_large(e->env_pgdir, pi, va, perm);
+	env_unlock(e);
+	if (retval < 0) {
+		page_free_order(pi, PAGE_MAX_ORDER);
+		return retval;
+	}
+	return 0;
+}
+
 // Allocate a page of memory and map it at 'va' with permission
 // 'perm' in the address space of 'envid'.
 // The page's contents are set to 0.
@@ -197,6 +355,7 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 //
 // perm -- PTE_U | PTE_P must be set, PTE_AVAIL | PTE_W may or may not be set,
 //         but no other bits may be set.  See PTE_SYSCALL in inc/mmu.h.
+//         PTE_PS asks for a 4MB page instead, see sys_page_alloc_large.
 //
 // Return 0 on success, < 0 on error.  Errors are:
 //	-E_BAD_ENV if environment envid doesn't currently exist,
@@ -217,18 +376,27 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 
 	if ((uintptr_t)va >= UTOP || (uintptr_t)va % PGSIZE != 0) {
 		return -E_INVAL;
-	} else if ((perm & ~PTE_SYSCALL) != 0) {
+	} else if ((perm & ~(PTE_SYSCALL | PTE_PS)) != 0) {
 		return -E_INVAL;
 	}
 
 	// LAB 9: Your code here.
+	// Runs without the big kernel lock, see syscall_is_parallel.
+	if (perm & PTE_PS) {
+		return sys_page_alloc_large(envid, va, perm & ~PTE_PS);
+	}
 	struct PageInfo *pi = page_alloc(ALLOC_ZERO);
+	if (!pi) {
+		return -E_NO_MEM;
+	}
 	struct Env *e = NULL;
-	int32_t retval = envid2env(envid, &e, 1);
+	int32_t retval = envid2env_lock(envid, &e, 1);
 	if (retval < 0) {
+		page_free(pi);
 		return retval;
 	}
 	retval = page_insert(e->env_pgdir, pi, va, perm);
+	env_unlock(e);
 	if (retval < 0) {
 		page_free(pi);
 		return retval;
@@ -236,6 +404,41 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 	return 0;
 }
 
+// The PTE_PS case of sys_page_map: map the whole 4MB page at the
+// 4MB-aligned 'srcva' at the 4MB-aligned 'dstva'.  Used by spawn to
+// pass on 4MB pages with PTE_SHARE.
+static int
+sys_page_map_large(envid_t srcenvid, void *srcva,
+		   envid_t dstenvid, void *dstva, int perm)
+{
+	if ((uintptr_t)srcva % PTSIZE != 0 || (uintptr_t)srcva >= UTOP ||
+	    (uintptr_t)dstva % PTSIZE != 0 || (uintptr_t)dstva >= UTOP ||
+	    PDX(dstva) == PDX(UXSTACKTOP - PGSIZE) ||
+	    (perm & ~(PTE_P | PTE_U | PTE_W | PTE_SHARE)) != 0) {
+		return -E_INVAL;
+	}
+
+	struct Env *srcenv = NULL;
+	struct Env *dstenv = NULL;
+	int32_t retval = envid2env_lock_pair(srcenvid, &srcenv,
+					     dstenvid, &dstenv, 1);
+	if (retval < 0) {
+		return retval;
+	}
+	pde_t pde = srcenv->env_pgdir[PDX(srcva)];
+	if ((pde & (PTE_P | PTE_PS)) != (PTE_P | PTE_PS) ||
+	    ((perm & PTE_W) && !(pde & PTE_W))) {
+		retval = -E_INVAL;
+		goto out;
+	}
+	retval = page_insert_large(dstenv->env_pgdir,
+				   pa2page(PTE_ADDR(pde)), dstva, perm);
+
+    out:
+	env_unlock_pair(srcenv, dstenv);
+	return retval;
+}
+
 // Map the page of memory at 'srcva' in srcenvid's address space
 // at 'dstva' in dstenvid's address space with permission 'perm'.
 // Perm has the same restrictions as in sys_page_alloc, except
@@ -252,10 +455,17 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 //	-E_INVAL if (perm & PTE_W), but srcva is read-only in srcenvid's
 //		address space.
 //	-E_NO_MEM if there's no memory to allocate any necessary page tables.
+//
+// A 4MB page can only be mapped as a whole, by passing PTE_PS in
+// 'perm', see sys_page_map_large.
 static int
 sys_page_map(envid_t srcenvid, void *srcva,
 	     envid_t dstenvid, void *dstva, int perm)
 {
+	if (perm & PTE_PS) {
+		return sys_page_map_large(srcenvid, srcva, dstenvid, dstva,
+					  perm & ~PTE_PS);
+	}
 	// Hint: This function is a wrapper around page_lookup() and
 	//   page_insert() from kern/pmap.c.
 	//   Again, most of the new code you write should be to check the
@@ -270,28 +480,37 @@ sys_page_map(envid_t srcenvid, void *srcva,
 	}
 
 	// LAB 9: Your code here.
+	// Runs without the big kernel lock, see syscall_is_parallel.
 	struct Env *srcenv = NULL;
-	int32_t retval = envid2env(srcenvid, &srcenv, 1);
-	if (retval < 0) {
-		return retval;
-	}
 	struct Env *dstenv = NULL;
-	retval = envid2env(dstenvid, &dstenv, 1);
+	int32_t retval = envid2env_lock_pair(srcenvid, &srcenv,
+					     dstenvid, &dstenv, 1);
 	if (retval < 0) {
 		return retval;
 	}
+	// PTE_W in a page table shared since fork is not to be trusted
+	// until the page table is split.
+	if ((perm & PTE_W) && pgdir_unshare(srcenv->env_pgdir, srcva) < 0) {
+		retval = -E_NO_MEM;
+		goto out;
+	}
 	pte_t *entry = NULL;
 	struct PageInfo *pi = page_lookup(srcenv->env_pgdir, srcva, &entry);
+	if (!pi || (*entry & PTE_PS)) {
+		retval = -E_INVAL;
+		goto out;
+	}
 	if ( (!(*entry & PTE_W))
 	     && (perm & PTE_W)
 	) {
-		return -E_INVAL;
+		retval = -E_INVAL;
+		goto out;
 	}
 	retval = page_insert(dstenv->env_pgdir, pi, dstva, perm);
-	if (retval < 0) {
-		return retval;
-	}
-	return 0;
+
+    out:
+	env_unlock_pair(srcenv, dstenv);
+	return retval;
 }
 
 // Unmap the page of memory at 'va' in the address space of 'envid'.
@@ -301,6 +520,8 @@ sys_page_map(envid_t srcenvid, void *srcva,
 //	-E_BAD_ENV if environment envid doesn't currently exist,
 //		or the caller doesn't have permission to change envid.
 //	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_NO_MEM if the page table is shared since fork and there's no
+//		memory to split it.
 static int
 sys_page_unmap(envid_t envid, void *va)
 {
@@ -311,15 +532,256 @@ sys_page_unmap(envid_t envid, void *va)
 		return -E_INVAL;
 	}
 
+	// Runs without the big kernel lock, see syscall_is_parallel.
 	struct Env *e = NULL;
-	int32_t retval = envid2env(envid, &e, 1);
+	int32_t retval = envid2env_lock(envid, &e, 1);
 	if (retval < 0) {
 		return retval;
 	}
-	page_remove(e->env_pgdir, va);
+	retval = page_remove(e->env_pgdir, va);
+	env_unlock(e);
+	return retval;
+}
+
+// Apply the 'n' page operations in the array 'ops' in order, as if
+// each was a separate sys_page_alloc, sys_page_map or sys_page_unmap
+// call, but with a single kernel entry and a single TLB flush.
+// Processing stops at the first operation that fails; the operations
+// before it stay applied.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_FAULT if 'ops' is not a readable array of 'n' operations.
+//	-E_INVAL if an operation code is unknown.
+//	Any error of the sys_page_* call that failed.
+static int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+	// The operations are copied in chunks, each checked just before
+	// it is read, since the batch may unmap the array itself.
+	struct PageOp chunk[16];
+	size_t i, j, m;
+	int32_t retval = 0;
+
+	if (n > UTOP / sizeof(*ops) ||
+	    user_mem_check(curenv, ops, n * sizeof(*ops), PTE_U) < 0) {
+		return -E_FAULT;
+	}
+
+	tlb_defer_begin();
+	for (i = 0; i < n && retval == 0; i += m) {
+		m = MIN(n - i, sizeof(chunk) / sizeof(chunk[0]));
+		env_lock(curenv);
+		if (user_mem_check_locked(curenv, ops + i, m * sizeof(*ops), PTE_U) < 0) {
+			env_unlock(curenv);
+			retval = -E_FAULT;
+			break;
+		}
+		memcpy(chunk, ops + i, m * sizeof(*ops));
+		env_unlock(curenv);
+
+		for (j = 0; j < m && retval == 0; j++) {
+			const struct PageOp *op = &chunk[j];
+			switch (op->op) {
+			case PAGEOP_ALLOC:
+				retval = sys_page_alloc(op->dstenv, op->dstva,
+							op->perm);
+				break;
+			case PAGEOP_MAP:
+				retval = sys_page_map(op->srcenv, op->srcva,
+						      op->dstenv, op->dstva,
+						      op->perm);
+				break;
+			case PAGEOP_UNMAP:
+				retval = sys_page_unmap(op->dstenv, op->dstva);
+				break;
+			default:
+				retval = -E_INVAL;
+			}
+		}
+	}
+	tlb_defer_end();
+	return retval;
+}
+
+// Check the page arguments of an IPC send from env src,
+// whose lock the caller holds.
+// Returns 0 if they are acceptable, -E_INVAL otherwise.
+static int
+ipc_check_page_locked(struct Env *src, void *srcva, unsigned perm)
+{
+	uint32_t va = (uint32_t)srcva;
+
+	if (va >= UTOP) {
+		return 0;
+	}
+	if ((va % PGSIZE) != 0) {
+		return -E_INVAL;
+	}
+	if ((perm & ~PTE_SYSCALL) != 0) {
+		return -E_INVAL;
+	}
+	if ((perm & PTE_W) && pgdir_unshare(src->env_pgdir, srcva) < 0) {
+		return -E_NO_MEM;
+	}
+
+	pte_t *entry = NULL;
+	struct PageInfo *p = page_lookup(src->env_pgdir, srcva, &entry);
+	if (!p || (*entry & PTE_PS)) {
+		return -E_INVAL;
+	}
+	if ((perm & PTE_W) && !(*entry & PTE_W)) {
+		return -E_INVAL;
+	}
 	return 0;
 }
 
+static int
+ipc_check_page(struct Env *src, void *srcva, unsigned perm)
+{
+	env_lock(src);
+	int32_t retval = ipc_check_page_locked(src, srcva, perm);
+	env_unlock(src);
+	return retval;
+}
+
+// Record that 'caller' is waiting in sys_ipc_call for the reply of
+// 'server', on the server's list of callers, which env_free fails when
+// the server goes away.
+static void
+ipc_add_caller(struct Env *server, struct Env *caller)
+{
+	caller->env_ipc_recving = true;
+	caller->env_ipc_recv_from = server->env_id;
+	caller->env_ipc_call_to = server;
+	caller->env_ipc_call_next = server->env_ipc_callers;
+	server->env_ipc_callers = caller;
+}
+
+// Take 'caller' off the list of callers of the server it waits for.
+static void
+ipc_drop_caller(struct Env *caller)
+{
+	struct Env **pp = &caller->env_ipc_call_to->env_ipc_callers;
+
+	while (*pp != caller)
+		pp = &(*pp)->env_ipc_call_next;
+	*pp = caller->env_ipc_call_next;
+	caller->env_ipc_call_next = NULL;
+	caller->env_ipc_call_to = NULL;
+}
+
+// Deliver a message from src to dst, which must be blocked in
+// sys_ipc_recv.  The message consists of the IPC_NMR words in 'mr'
+// and an optional page.  On success dst stops receiving, but it is
+// up to the caller to make it runnable again.
+static int
+ipc_deliver(struct Env *dst, struct Env *src, const uint32_t *mr,
+	    void *srcva, unsigned perm)
+{
+	env_lock_pair(dst, src);
+	int32_t retval = ipc_check_page_locked(src, srcva, perm);
+	if (retval < 0) {
+		goto out;
+	}
+
+	int32_t received_perm = 0;
+	if ((uint32_t)srcva < UTOP && (uint32_t)dst->env_ipc_dstva < UTOP) {
+		struct PageInfo *p = page_lookup(src->env_pgdir, srcva, NULL);
+		retval = page_insert(dst->env_pgdir, p, dst->env_ipc_dstva, perm);
+		if (retval < 0) {
+			goto out;
+		}
+		received_perm = perm;
+	}
+
+	memcpy(dst->env_ipc_mr, mr, sizeof(dst->env_ipc_mr));
+	dst->env_ipc_value = mr[0];
+	dst->env_ipc_from = src->env_id;
+	dst->env_ipc_perm = received_perm;
+	dst->env_ipc_recving = false;
+	dst->env_ipc_recv_from = 0;
+	if (dst->env_ipc_call_to) {
+		ipc_drop_caller(dst);
+	}
+
+    out:
+	env_unlock_pair(dst, src);
+	return retval;
+}
+
+// Is dst blocked receiving, and willing to take a message from src?
+static bool
+ipc_can_recv(struct Env *dst, struct Env *src)
+{
+	return dst->env_ipc_recving &&
+	       (!dst->env_ipc_recv_from || dst->env_ipc_recv_from == src->env_id);
+}
+
+// Park curenv at the tail of dst's FIFO of blocked senders.
+// If 'call' is set, curenv waits for a reply from dst once the
+// message is taken, see sys_ipc_call.
+static void
+ipc_enqueue_sender(struct Env *dst, const uint32_t *mr, void *srcva,
+		   unsigned perm, bool call)
+{
+	curenv->env_ipc_send_to = dst;
+	memcpy(curenv->env_ipc_send_mr, mr, sizeof(curenv->env_ipc_send_mr));
+	curenv->env_ipc_send_srcva = srcva;
+	curenv->env_ipc_send_perm = perm;
+	curenv->env_ipc_send_call = call;
+	curenv->env_ipc_send_next = NULL;
+	if (dst->env_ipc_senders_tail) {
+		dst->env_ipc_senders_tail->env_ipc_send_next = curenv;
+	} else {
+		dst->env_ipc_senders = curenv;
+	}
+	dst->env_ipc_senders_tail = curenv;
+	sched_set_status(curenv, ENV_NOT_RUNNABLE);
+}
+
+// Take the first message dst is willing to receive from its FIFO of
+// blocked senders, and let the sender continue.  A sender blocked in
+// sys_ipc_call goes on waiting, now for the reply from dst.
+// Returns true if a message was delivered.
+static bool
+ipc_take_queued(struct Env *dst)
+{
+	struct Env **pp = &dst->env_ipc_senders;
+	struct Env *prev = NULL;
+	struct Env *sender;
+
+	while ((sender = *pp) != NULL) {
+		if (!ipc_can_recv(dst, sender)) {
+			prev = sender;
+			pp = &sender->env_ipc_send_next;
+			continue;
+		}
+
+		*pp = sender->env_ipc_send_next;
+		if (dst->env_ipc_senders_tail == sender) {
+			dst->env_ipc_senders_tail = prev;
+		}
+		sender->env_ipc_send_next = NULL;
+		sender->env_ipc_send_to = NULL;
+
+		int32_t retval = ipc_deliver(dst, sender,
+					     sender->env_ipc_send_mr,
+					     sender->env_ipc_send_srcva,
+					     sender->env_ipc_send_perm);
+		if (retval == 0 && sender->env_ipc_send_call) {
+			ipc_add_caller(dst, sender);
+			sender->env_tf.tf_regs.reg_eax = 0;
+			return true;
+		}
+		sender->env_tf.tf_regs.reg_eax = retval;
+		sched_set_status(sender, ENV_RUNNABLE);
+		if (retval == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
 // Try to send 'value' to the target env 'envid'.
 // If srcva < UTOP, then also send page currently mapped at 'srcva',
 // so that receiver gets a duplicate mapping of the same page.
@@ -359,49 +821,71 @@ sys_page_unmap(envid_t envid, void *va)
 //	-E_NO_MEM if there's not enough memory to map srcva in envid's
 //		address space.
 static int
-sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
+ipc_try_send(envid_t envid, const uint32_t *mr, void *srcva, unsigned perm)
 {
-	// LAB 9: Your code here.
-	uint32_t va = (uint32_t)srcva;
 	struct Env *env = NULL;
 	int32_t retval = envid2env(envid, &env, 0);
 	if (retval < 0) {
 		return retval;
 	}
-	if (!env->env_ipc_recving) {
-		return -E_IPC_NOT_RECV;
+	retval = ipc_check_page(curenv, srcva, perm);
+	if (retval < 0) {
+		return retval;
 	}
-	if (va < UTOP && (va % PGSIZE) != 0) {
-		return -E_INVAL;
+	if (!ipc_can_recv(env, curenv)) {
+		return -E_IPC_NOT_RECV;
 	}
-	if (va < UTOP && (perm & ~PTE_SYSCALL) != 0) {
-		return -E_INVAL;
+
+	retval = ipc_deliver(env, curenv, mr, srcva, perm);
+	if (retval < 0) {
+		return retval;
 	}
+	sched_set_status(env, ENV_RUNNABLE);
+	return 0;
+}
 
-	int32_t received_perm = 0;
-	if (va < UTOP) {
-		pte_t *entry = NULL;
-		struct PageInfo *p = page_lookup(curenv->env_pgdir, srcva, &entry);
-		if (!p) {
-			return -E_INVAL;
-		}
-		if ((perm & PTE_W) && !(*entry & PTE_W)) {
-			return -E_INVAL;
-		}
-		retval = page_insert(env->env_pgdir, p, env->env_ipc_dstva, perm);
-		if (retval < 0) {
-			return retval;
-		}
-		received_perm = perm;
+static int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
+{
+	// LAB 9: Your code here.
+	uint32_t mr[IPC_NMR] = { value };
+
+	return ipc_try_send(envid, mr, srcva, perm);
+}
+
+// Send 'value' (and the page at 'srcva' with 'perm') to the target
+// env 'envid', blocking until the target receives it.
+//
+// If the target is already waiting in sys_ipc_recv, this behaves like
+// sys_ipc_try_send.  Otherwise the caller is marked not runnable and
+// appended to the target's FIFO of blocked senders; the target picks
+// the senders up in order as it calls sys_ipc_recv.  The page arguments
+// are checked again at delivery time, since the sender's address space
+// may have changed while it was blocked.
+//
+// Returns 0 once the message is delivered, < 0 on error.  Errors are
+// those of sys_ipc_try_send, except -E_IPC_NOT_RECV, and:
+//	-E_INVAL if envid is the caller itself.
+//	-E_BAD_ENV if the target exits while the caller is blocked.
+static int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
+{
+	uint32_t mr[IPC_NMR] = { value };
+	int32_t retval = ipc_try_send(envid, mr, srcva, perm);
+	if (retval != -E_IPC_NOT_RECV) {
+		return retval;
 	}
 
-	env->env_ipc_value = value;
-	env->env_ipc_from = curenv->env_id;
-	env->env_ipc_perm = received_perm;
+	struct Env *env = NULL;
+	envid2env(envid, &env, 0);
+	if (env == curenv) {
+		return -E_INVAL;
+	}
 
-	env->env_ipc_recving = false;
-	env->env_status = ENV_RUNNABLE;
-	return 0;
+	// The receiver stores the result in our eax when it takes the message.
+	ipc_enqueue_sender(env, mr, srcva, perm, false);
+	curenv->env_tf.tf_regs.reg_eax = 0;
+	sched_yield();
 }
 
 // Block until a value is ready.  Record that you want to receive
@@ -411,8 +895,12 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 // If 'dstva' is < UTOP, then you are willing to receive a page of data.
 // 'dstva' is the virtual address at which the sent page should be mapped.
 //
-// This function only returns on error, but the system call will eventually
-// return 0 on success.
+// If some environment is already blocked in sys_ipc_send to us, its
+// message is taken at once, the sender is woken up, and this function
+// returns 0 without giving up the CPU.
+//
+// This function only returns on error or if a blocked sender was
+// waiting, but the system call will eventually return 0 on success.
 // Return < 0 on error.  Errors are:
 //	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
 static int
@@ -420,79 +908,679 @@ sys_ipc_recv(void *dstva)
 {
 	// LAB 9: Your code here.
 	uint32_t va = (uint32_t)dstva;
-	if (va % PGSIZE != 0) {
+	if (va < UTOP && va % PGSIZE != 0) {
 		return -E_INVAL;
 	}
 
-	curenv->env_status = ENV_NOT_RUNNABLE;
 	curenv->env_ipc_recving = true;
+	curenv->env_ipc_recv_from = 0;
+	curenv->env_ipc_dstva = dstva;
+	if (ipc_take_queued(curenv)) {
+		return 0;
+	}
 
-	if (va >= UTOP) {
-		// then we are not ready to receive a page of data
-		curenv->env_tf.tf_regs.reg_eax = 0;
-		// should not return
+	sched_set_status(curenv, ENV_NOT_RUNNABLE);
+	curenv->env_tf.tf_regs.reg_eax = 0;
+	// should not return
+	sched_yield();
+}
+
+// Send the message 'mr' (and the page at 'srcva' with 'perm') to
+// 'envid' and wait for its reply, see sys_ipc_call.
+static int
+ipc_call(envid_t envid, const uint32_t *mr, void *srcva, unsigned perm,
+	 void *dstva)
+{
+	if ((uint32_t)dstva < UTOP && (uint32_t)dstva % PGSIZE != 0) {
+		return -E_INVAL;
+	}
+
+	struct Env *env = NULL;
+	int32_t retval = envid2env(envid, &env, 0);
+	if (retval < 0) {
+		return retval;
+	}
+	if (env == curenv) {
+		return -E_INVAL;
+	}
+	retval = ipc_check_page(curenv, srcva, perm);
+	if (retval < 0) {
+		return retval;
+	}
+
+	curenv->env_ipc_dstva = dstva;
+	curenv->env_tf.tf_regs.reg_eax = 0;
+
+	if (!ipc_can_recv(env, curenv)) {
+		ipc_enqueue_sender(env, mr, srcva, perm, true);
 		sched_yield();
 	}
 
-	// if we are ready to receive a page of data
+	retval = ipc_deliver(env, curenv, mr, srcva, perm);
+	if (retval < 0) {
+		return retval;
+	}
+	ipc_add_caller(env, curenv);
+	sched_set_status(curenv, ENV_NOT_RUNNABLE);
+	env->env_tf.tf_regs.reg_eax = 0;
+	env_run(env);
+}
+
+// Send the message 'mr' (and the page at 'srcva' with 'perm') to
+// 'envid' unless it is 0, then wait for the next message, see
+// sys_ipc_reply_wait.
+static int
+ipc_reply_wait(envid_t envid, const uint32_t *mr, void *srcva,
+	       unsigned perm, void *dstva)
+{
+	if ((uint32_t)dstva < UTOP && (uint32_t)dstva % PGSIZE != 0) {
+		return -E_INVAL;
+	}
+
+	struct Env *env = NULL;
+	if (envid) {
+		int32_t retval = ipc_try_send(envid, mr, srcva, perm);
+		if (retval < 0) {
+			return retval;
+		}
+		envid2env(envid, &env, 0);
+	}
+
+	curenv->env_ipc_recving = true;
+	curenv->env_ipc_recv_from = 0;
 	curenv->env_ipc_dstva = dstva;
+	if (ipc_take_queued(curenv)) {
+		return 0;
+	}
+
+	sched_set_status(curenv, ENV_NOT_RUNNABLE);
+	curenv->env_tf.tf_regs.reg_eax = 0;
+	if (env) {
+		env_run(env);
+	}
+	sched_yield();
+}
+
+// Send a request to 'envid' and wait for its reply, as a single
+// system call.  The arguments are those of sys_ipc_send, plus 'dstva',
+// which is used like in sys_ipc_recv for the reply.
+//
+// While waiting for the reply the caller accepts messages only from
+// 'envid'; other senders stay queued.  If 'envid' is already blocked
+// receiving, the message is handed over and the CPU is switched
+// straight to 'envid' without a pass through the scheduler.
+// Otherwise the caller joins the FIFO of blocked senders of 'envid'.
+//
+// Returns 0 once the reply has arrived (find it in thisenv as for
+// sys_ipc_recv), < 0 on error.  Errors are those of sys_ipc_send and
+// sys_ipc_recv.
+static int
+sys_ipc_call(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+	     void *dstva)
+{
+	uint32_t mr[IPC_NMR] = { value };
+
+	return ipc_call(envid, mr, srcva, perm, dstva);
+}
+
+// Reply to 'envid' and wait for the next message from anybody, as a
+// single system call.  This is the server side of sys_ipc_call.
+// If 'envid' is 0 nothing is sent.
+//
+// The reply never blocks: 'envid' must already be waiting for it,
+// usually in sys_ipc_call.  If no other message is queued for the
+// caller, the CPU is switched straight to 'envid'.
+//
+// Returns 0 once a message has arrived, < 0 on error.  If the reply
+// fails the caller does not start waiting.  Errors are those of
+// sys_ipc_try_send and sys_ipc_recv.
+static int
+sys_ipc_reply_wait(envid_t envid, uint32_t value, void *srcva,
+		   unsigned perm, void *dstva)
+{
+	uint32_t mr[IPC_NMR] = { value };
+
+	return ipc_reply_wait(envid, mr, srcva, perm, dstva);
+}
+
+// Like sys_ipc_call, but the request is the IPC_NMR words w0..w3
+// and no page is sent or received.  The receiver finds the words
+// in env_ipc_mr.
+static int
+sys_ipc_call_mr(envid_t envid, uint32_t w0, uint32_t w1, uint32_t w2,
+		uint32_t w3)
+{
+	uint32_t mr[IPC_NMR] = { w0, w1, w2, w3 };
+
+	return ipc_call(envid, mr, (void *)UTOP, 0, (void *)UTOP);
+}
+
+// Like sys_ipc_reply_wait, but the reply is the IPC_NMR words w0..w3
+// and no page is sent.  A page may still be received with the next
+// message: it is mapped at the same dstva as for the previous one.
+static int
+sys_ipc_reply_wait_mr(envid_t envid, uint32_t w0, uint32_t w1, uint32_t w2,
+		      uint32_t w3)
+{
+	uint32_t mr[IPC_NMR] = { w0, w1, w2, w3 };
+
+	return ipc_reply_wait(envid, mr, (void *)UTOP, 0,
+			      curenv->env_ipc_dstva);
+}
+
+// Environments blocked in sys_notify_wait, hashed by the physical
+// address of the word they wait on.  Physical addresses are used so
+// that envs sharing a page can wait and wake through different VAs.
+#define NOTIFY_NBUCKETS	64
+static struct Env *notify_buckets[NOTIFY_NBUCKETS];
+
+static struct Env **
+notify_bucket(physaddr_t pa)
+{
+	return &notify_buckets[(pa >> 2) % NOTIFY_NBUCKETS];
+}
+
+// Translate the user word at 'uaddr' to a physical address.
+// Returns 0 if it is not a valid, aligned, mapped user word.
+// The caller must hold curenv's lock.
+static physaddr_t
+notify_addr(uint32_t *uaddr)
+{
+	if ((uint32_t)uaddr >= UTOP || (uint32_t)uaddr % sizeof(uint32_t) != 0 ||
+	    user_mem_check_locked(curenv, uaddr, sizeof(uint32_t), PTE_U) < 0) {
+		return 0;
+	}
+	struct PageInfo *p = page_lookup(curenv->env_pgdir, uaddr, NULL);
+	return page2pa(p) + PGOFF(uaddr);
+}
+
+// Remove e from the notification wait queue, if it is on it.
+void
+notify_cancel(struct Env *e)
+{
+	struct Env **pp;
+
+	if (!e->env_notify_pa) {
+		return;
+	}
+	for (pp = notify_bucket(e->env_notify_pa); *pp != e;
+	     pp = &(*pp)->env_notify_next)
+		/* do nothing */;
+	*pp = e->env_notify_next;
+	e->env_notify_next = NULL;
+	e->env_notify_pa = 0;
+}
+
+// Block until another environment calls sys_notify_wake on the same
+// word, but only if the word at 'uaddr' still holds 'expected'.
+// The check and the block happen atomically with respect to
+// sys_notify_wake, so a wakeup cannot be lost between a user-level
+// test of the word and this call.
+//
+// Returns 0 when woken up, or at once if *uaddr != expected.
+// Returns < 0 on error.  Errors are:
+//	-E_INVAL if uaddr is not an aligned word mapped in the caller's
+//		address space.
+static int
+sys_notify_wait(uint32_t *uaddr, uint32_t expected)
+{
+	env_lock(curenv);
+	physaddr_t pa = notify_addr(uaddr);
+	if (!pa) {
+		env_unlock(curenv);
+		return -E_INVAL;
+	}
+	if (*uaddr != expected) {
+		env_unlock(curenv);
+		return 0;
+	}
+	env_unlock(curenv);
+
+	struct Env **bucket = notify_bucket(pa);
+	curenv->env_notify_pa = pa;
+	curenv->env_notify_next = *bucket;
+	*bucket = curenv;
+	sched_set_status(curenv, ENV_NOT_RUNNABLE);
 	curenv->env_tf.tf_regs.reg_eax = 0;
-	// should not return
 	sched_yield();
 }
 
+// Wake up all environments blocked in sys_notify_wait on the word
+// at 'uaddr'.
+//
+// Returns the number of environments woken, < 0 on error.  Errors are:
+//	-E_INVAL if uaddr is not an aligned word mapped in the caller's
+//		address space.
+static int
+sys_notify_wake(uint32_t *uaddr)
+{
+	env_lock(curenv);
+	physaddr_t pa = notify_addr(uaddr);
+	env_unlock(curenv);
+	if (!pa) {
+		return -E_INVAL;
+	}
+
+	int nwoken = 0;
+	struct Env **pp = notify_bucket(pa);
+	while (*pp) {
+		struct Env *e = *pp;
+		if (e->env_notify_pa != pa) {
+			pp = &e->env_notify_next;
+			continue;
+		}
+		*pp = e->env_notify_next;
+		e->env_notify_next = NULL;
+		e->env_notify_pa = 0;
+		sched_set_status(e, ENV_RUNNABLE);
+		nwoken++;
+	}
+	return nwoken;
+}
+
 // Return date and time in UNIX timestamp format: seconds passed
 // from 1970-01-01 00:00:00 UTC.
 static int
 sys_gettime(void)
 {
 	// LAB 12: Your code here.
-	return gettime();
+	// Kept up to date by the timer tick (see vsys_tick), so
+	// there is no need to read the RTC again.
+	return vsys[VSYS_gettime];
 }
 
-// Dispatches to the correct kernel function, passing the arguments.
-int32_t
-syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+// Give the calling environment a system call ring (see struct SysRing),
+// a fresh page mapped read-write at 'va'.  The kernel keeps a reference
+// of its own and works on the ring through its KERNBASE mapping, so the
+// env cannot pull the page out from under sys_ring_enter.  The page is
+// mapped with PTE_SHARE: were it copy-on-write after a fork, the env
+// would go on writing its own copy while the kernel read the original.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_INVAL if the environment already has a ring.
+//	-E_NO_MEM if there's no memory to allocate the ring,
+//		or to allocate any necessary page tables.
+static int
+sys_ring_setup(void *va)
 {
-	// Call the function corresponding to the 'syscallno' parameter.
-	// Return any appropriate return value.
-	// LAB 8: Your code here.
-	//
-	if (syscallno == SYS_cputs) {
-		user_mem_assert(curenv, (char*)a1, a2, PTE_U);
-		sys_cputs((char *)a1, (size_t)a2);
-		return 0;
-	} else if (syscallno == SYS_cgetc) {
-		return sys_cgetc();
-	} else if (syscallno == SYS_getenvid) {
-		return sys_getenvid();
-	} else if (syscallno == SYS_env_destroy) {
-		return sys_env_destroy(a1);
-	} else if (syscallno == SYS_page_alloc) {
-		return sys_page_alloc(a1, (void*)a2, a3);
-	} else if (syscallno == SYS_page_map) {
-		return sys_page_map(a1, (void*)a2, a3, (void*)a4, a5);
-	} else if (syscallno == SYS_page_unmap) {
-		return sys_page_unmap(a1, (void*)a2);
-	} else if (syscallno == SYS_exofork) {
-		return sys_exofork();
-	} else if (syscallno == SYS_env_set_status) {
-		return sys_env_set_status(a1, a2);
-	} else if (syscallno == SYS_env_set_pgfault_upcall) {
-		return sys_env_set_pgfault_upcall(a1, (void*)a2);
-	} else if (syscallno == SYS_yield) {
-		sys_yield();
-	} else if (syscallno == SYS_ipc_try_send) {
-		return sys_ipc_try_send(a1, a2, (void*)a3, a4);
-	} else if (syscallno == SYS_ipc_recv) {
-		return sys_ipc_recv((void*)a1);
-	} else if (syscallno == SYS_env_set_trapframe) {
-		return sys_env_set_trapframe(a1, (void*)a2);
-	} else if (syscallno == SYS_gettime) {
-		return sys_gettime();
-	} else {
+	struct PageInfo *pp;
+	int r;
+
+	if ((uintptr_t)va >= UTOP || (uintptr_t)va % PGSIZE != 0)
+		return -E_INVAL;
+	if (curenv->env_sysring)
+		return -E_INVAL;
+
+	if (!(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+	env_lock(curenv);
+	r = page_insert(curenv->env_pgdir, pp, va,
+			PTE_P | PTE_U | PTE_W | PTE_SHARE);
+	env_unlock(curenv);
+	if (r < 0) {
+		page_free(pp);
+		return r;
+	}
+	page_incref(pp);
+	curenv->env_sysring = pp;
+	return 0;
+}
+
+// Make up to 'to_submit' of the calls queued on the calling
+// environment's system call ring, in order, and post a completion for
+// each.  Stops early when the submission queue runs empty or the
+// completion queue fills up, and after a call that stopped the env.
+//
+// Every call goes through syscall(), like one made with a trap.  Only
+// calls that just return a value (see syscall_is_fast) can be made
+// from the ring; any other call completes with -E_NOT_SUPP.
+//
+// So every call has completed by the time sys_ring_enter returns, and
+// waiting for more would wait forever: if fewer than 'min_complete'
+// completions would be left on the queue, nothing is done.
+//
+// Returns the number of calls made, < 0 on error.  Errors are:
+//	-E_INVAL if the environment has no ring, or its counters are
+//		inconsistent.
+//	-E_INVAL if fewer than 'min_complete' completions would be waiting.
+static int
+sys_ring_enter(uint32_t to_submit, uint32_t min_complete)
+{
+	struct SysRing *r;
+	uint32_t sq_head, cq_tail, nsq, ncq, n, i;
+
+	if (!curenv->env_sysring)
+		return -E_INVAL;
+	r = page2kva(curenv->env_sysring);
+
+	// The env may scribble over the counters, so read each one once
+	// and never trust them for more than picking queue slots.
+	sq_head = r->sq_head;
+	cq_tail = r->cq_tail;
+	nsq = r->sq_tail - sq_head;
+	ncq = cq_tail - r->cq_head;
+	if (nsq > SYSRING_NSQE || ncq > SYSRING_NCQE)
+		return -E_INVAL;
+
+	n = MIN(MIN(to_submit, nsq), SYSRING_NCQE - ncq);
+	if (ncq + n < min_complete)
 		return -E_INVAL;
+
+	for (i = 0; i < n; ) {
+		struct SysRingSQE sqe = r->sq[(sq_head + i) % SYSRING_NSQE];
+		struct SysRingCQE *cqe = &r->cq[(cq_tail + i) % SYSRING_NCQE];
+
+		cqe->cqe_res = -E_NOT_SUPP;
+		if (syscall_is_fast(sqe.sqe_num))
+			cqe->cqe_res = syscall(sqe.sqe_num, sqe.sqe_args[0],
+					       sqe.sqe_args[1], sqe.sqe_args[2],
+					       sqe.sqe_args[3], sqe.sqe_args[4]);
+		cqe->cqe_data = sqe.sqe_data;
+		i++;
+		r->sq_head = sq_head + i;
+		r->cq_tail = cq_tail + i;
+		if (curenv->env_status != ENV_RUNNING)
+			break;
+	}
+	return i;
+}
+
+// Can system call 'syscallno' run without the big kernel lock?
+// These calls take the locks they need themselves (see the lock order
+// in kern/spinlock.h), so that, for example, page allocations on
+// different CPUs proceed in parallel.  trap() takes the big kernel
+// lock for all the others.
+bool
+syscall_is_parallel(uint32_t syscallno)
+{
+	switch (syscallno) {
+	case SYS_getenvid:
+	case SYS_page_alloc:
+	case SYS_page_map:
+	case SYS_page_unmap:
+	case SYS_page_map_batch:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Does system call 'syscallno' just return a value to its caller?
+// These calls never block, never switch to another env on their own
+// and never look at curenv->env_tf, so the SYSENTER path can make them
+// without saving the caller's registers (see sysenter_syscall).
+// A call that marks curenv not runnable is still fine, since
+// sysenter_syscall checks for that afterwards.
+bool
+syscall_is_fast(uint32_t syscallno)
+{
+	switch (syscallno) {
+	case SYS_cputs:
+	case SYS_cgetc:
+	case SYS_getenvid:
+	case SYS_env_destroy:
+	case SYS_page_alloc:
+	case SYS_page_map:
+	case SYS_page_unmap:
+	case SYS_page_map_batch:
+	case SYS_env_set_status:
+	case SYS_env_set_pgfault_upcall:
+	case SYS_env_set_kcow:
+	case SYS_env_set_nice:
+	case SYS_ipc_try_send:
+	case SYS_notify_wake:
+	case SYS_gettime:
+		return true;
+	default:
+		return false;
 	}
+}
+
+// The system call table.  Every entry takes the five raw arguments
+// and passes on the ones its system call uses.
+
+static int32_t
+sc_cputs(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	user_mem_assert(curenv, (char*)a1, a2, PTE_U);
+	sys_cputs((char *)a1, (size_t)a2);
+	return 0;
+}
+
+static int32_t
+sc_cgetc(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_cgetc();
+}
+
+static int32_t
+sc_getenvid(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_getenvid();
+}
+
+static int32_t
+sc_env_destroy(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_env_destroy(a1);
+}
+
+static int32_t
+sc_page_alloc(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_page_alloc(a1, (void*)a2, a3);
+}
+
+static int32_t
+sc_page_map(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_page_map(a1, (void*)a2, a3, (void*)a4, a5);
+}
+
+static int32_t
+sc_page_unmap(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_page_unmap(a1, (void*)a2);
+}
+
+static int32_t
+sc_exofork(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_exofork();
+}
+
+static int32_t
+sc_env_set_status(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_env_set_status(a1, a2);
+}
+
+static int32_t
+sc_env_set_trapframe(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_env_set_trapframe(a1, (void*)a2);
+}
+
+static int32_t
+sc_env_set_pgfault_upcall(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_env_set_pgfault_upcall(a1, (void*)a2);
+}
+
+static int32_t
+sc_yield(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	sys_yield();
 	return 0;
 }
 
+static int32_t
+sc_ipc_try_send(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_ipc_try_send(a1, a2, (void*)a3, a4);
+}
+
+static int32_t
+sc_ipc_recv(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_ipc_recv((void*)a1);
+}
+
+static int32_t
+sc_gettime(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_gettime();
+}
+
+static int32_t
+sc_env_set_nice(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_env_set_nice(a1, a2);
+}
+
+static int32_t
+sc_ipc_send(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_ipc_send(a1, a2, (void*)a3, a4);
+}
+
+static int32_t
+sc_ipc_call(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_ipc_call(a1, a2, (void*)a3, a4, (void*)a5);
+}
+
+static int32_t
+sc_ipc_reply_wait(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_ipc_reply_wait(a1, a2, (void*)a3, a4, (void*)a5);
+}
+
+static int32_t
+sc_ipc_call_mr(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_ipc_call_mr(a1, a2, a3, a4, a5);
+}
+
+static int32_t
+sc_ipc_reply_wait_mr(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_ipc_reply_wait_mr(a1, a2, a3, a4, a5);
+}
+
+static int32_t
+sc_notify_wait(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_notify_wait((uint32_t*)a1, a2);
+}
+
+static int32_t
+sc_notify_wake(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_notify_wake((uint32_t*)a1);
+}
+
+static int32_t
+sc_fork(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_fork();
+}
+
+static int32_t
+sc_env_set_kcow(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_env_set_kcow(a1, a2);
+}
+
+static int32_t
+sc_page_map_batch(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_page_map_batch((const struct PageOp *)a1, a2);
+}
+
+static int32_t
+sc_ring_setup(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_ring_setup((void*)a1);
+}
+
+static int32_t
+sc_ring_enter(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	return sys_ring_enter(a1, a2);
+}
+
+#define SYSCALL(name)	[SYS_##name] = { sc_##name, #name }
+
+const struct Syscall syscalls[NSYSCALLS] = {
+	SYSCALL(cputs),
+	SYSCALL(cgetc),
+	SYSCALL(getenvid),
+	SYSCALL(env_destroy),
+	SYSCALL(page_alloc),
+	SYSCALL(page_map),
+	SYSCALL(page_unmap),
+	SYSCALL(exofork),
+	SYSCALL(env_set_status),
+	SYSCALL(env_set_trapframe),
+	SYSCALL(env_set_pgfault_upcall),
+	SYSCALL(yield),
+	SYSCALL(ipc_try_send),
+	SYSCALL(ipc_recv),
+	SYSCALL(gettime),
+	SYSCALL(env_set_nice),
+	SYSCALL(ipc_send),
+	SYSCALL(ipc_call),
+	SYSCALL(ipc_reply_wait),
+	SYSCALL(ipc_call_mr),
+	SYSCALL(ipc_reply_wait_mr),
+	SYSCALL(notify_wait),
+	SYSCALL(notify_wake),
+	SYSCALL(fork),
+	SYSCALL(env_set_kcow),
+	SYSCALL(page_map_batch),
+	SYSCALL(ring_setup),
+	SYSCALL(ring_enter),
+};
+
+// Per-system-call statistics, one page mapped read-only at USYSSTATS.
+// Allocated by mem_init.  Parallel system calls update them without
+// the big kernel lock, hence the atomic adds.
+struct SyscallStats *syscall_stats;
+
+// Account one call to 'st' that took 'cycles' TSC cycles.
+static void
+syscall_account(struct SyscallStats *st, uint64_t cycles)
+{
+	int b = 0;
+
+	if (cycles >= (1 << SYSHIST_SHIFT))
+		b = cycles >> 32 ? NSYSHIST - 1 :
+		    31 - __builtin_clz((uint32_t) cycles) - SYSHIST_SHIFT + 1;
+	if (b >= NSYSHIST)
+		b = NSYSHIST - 1;
+	__sync_fetch_and_add(&st->sc_hist[b], 1);
+	__sync_fetch_and_add(&st->sc_cycles, cycles);
+}
+
+// Dispatches to the correct kernel function, passing the arguments.
+// Every call is counted on entry; only calls that return here are
+// timed, since one that blocks or switches to another env never does.
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+	struct SyscallStats *st;
+	uint64_t start;
+	int32_t ret;
+
+	if (syscallno >= NSYSCALLS || !syscalls[syscallno].sc_func)
+		return -E_INVAL;
+
+	st = &syscall_stats[syscallno];
+	__sync_fetch_and_add(&st->sc_count, 1);
+	start = read_tsc();
+	ret = syscalls[syscallno].sc_func(a1, a2, a3, a4, a5);
+	syscall_account(st, read_tsc() - start);
+	return ret;
+}
@@ -6,6 +6,19 @@
 
 #include <inc/syscall.h>
 
+struct Syscall {
+	int32_t (*sc_func)(uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5);
+	const char *sc_name;
+};
+
+extern const struct Syscall syscalls[NSYSCALLS];
+extern struct SyscallStats *syscall_stats;
+
 int32_t syscall(uint32_t num, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5);
+bool syscall_is_parallel(uint32_t num);
+bool syscall_is_fast(uint32_t num);
+
+struct Env;
+void notify_cancel(struct Env *e);
 
 #endif /* !JOS_KERN_SYSCALL_H */
@@ -15,13 +15,12 @@
 #include <kern/picirq.h>
 #include <kern/cpu.h>
 #include <kern/vsyscall.h>
+#include <kern/spinlock.h>
 
 #ifndef debug
 # define debug 0
 #endif
 
-static struct Taskstate ts;
-
 /* For debugging, so print_trapframe can distinguish between printing
  * a saved trapframe and printing the current trapframe and print some
  * additional information in the latter case.
@@ -58,6 +57,14 @@ void mchk_thdlr();
 void simderr_thdlr();
 
 void syscall_thdlr();
+#ifndef CONFIG_KSPACE
+void sysenter_handler();
+#endif
+
+void timer_thdlr();
+void spurious_thdlr();
+void error_thdlr();
+void tlbflush_thdlr();
 void kbd_thdlr();
 void serial_thdlr();
 
@@ -130,6 +137,12 @@ trap_init(void)
 	SETGATE(idt[IRQ_OFFSET + IRQ_KBD], 0, GD_KT, (int)(& kbd_thdlr ), 0);
 	SETGATE(idt[IRQ_OFFSET + IRQ_SERIAL], 0, GD_KT, (int)(& serial_thdlr ), 0);
 
+	// Local APIC interrupts
+	SETGATE(idt[IRQ_OFFSET + IRQ_TIMER], 0, GD_KT, (int)(& timer_thdlr ), 0);
+	SETGATE(idt[IRQ_OFFSET + IRQ_SPURIOUS], 0, GD_KT, (int)(& spurious_thdlr ), 0);
+	SETGATE(idt[IRQ_OFFSET + IRQ_ERROR], 0, GD_KT, (int)(& error_thdlr ), 0);
+	SETGATE(idt[IRQ_OFFSET + IRQ_TLBFLUSH], 0, GD_KT, (int)(& tlbflush_thdlr ), 0);
+
 	// Per-CPU setup 
 	trap_init_percpu();
 }
@@ -140,22 +153,42 @@ trap_init(void)
 void
 trap_init_percpu(void)
 {
+	// Each CPU has its own TSS, pointing at its own kernel stack
+	// (see mem_init_mp), and its own TSS descriptor in the gdt.
+	int i = thiscpu->cpu_id;
+	struct Taskstate *ts = &thiscpu->cpu_ts;
+
 	// Setup a TSS so that we get the right stack
 	// when we trap to the kernel.
-	ts.ts_esp0 = KSTACKTOP;
-	ts.ts_ss0 = GD_KD;
+	ts->ts_esp0 = KSTACKTOP - i * (KSTKSIZE + KSTKGAP);
+	ts->ts_ss0 = GD_KD;
+	ts->ts_iomb = sizeof(struct Taskstate);
 
 	// Initialize the TSS slot of the gdt.
-	gdt[GD_TSS0 >> 3] = SEG16(STS_T32A, (uint32_t) (&ts),
-					sizeof(struct Taskstate), 0);
-	gdt[GD_TSS0 >> 3].sd_s = 0;
+	gdt[(GD_TSS0 >> 3) + i] = SEG16(STS_T32A, (uint32_t) ts,
+					sizeof(struct Taskstate) - 1, 0);
+	gdt[(GD_TSS0 >> 3) + i].sd_s = 0;
 
 	// Load the TSS selector (like other segment selectors, the
 	// bottom three bits are special; we leave them 0)
-	ltr(GD_TSS0);
+	ltr(GD_TSS0 + (i << 3));
 
 	// Load the IDT
 	lidt(&idt_pd);
+
+#ifndef CONFIG_KSPACE
+	// System calls made with SYSENTER start at sysenter_handler on the
+	// same kernel stack.  SYSEXIT takes the user code and stack segments
+	// to be 16 and 24 bytes past the kernel code segment, which is
+	// where GD_UT and GD_UD are.
+	uint32_t edx;
+	cpuid(1, NULL, NULL, NULL, &edx);
+	if (edx & CPUID_FEAT_SEP) {
+		wrmsr(MSR_IA32_SYSENTER_CS, GD_KT);
+		wrmsr(MSR_IA32_SYSENTER_ESP, ts->ts_esp0);
+		wrmsr(MSR_IA32_SYSENTER_EIP, (uint32_t) sysenter_handler);
+	}
+#endif
 }
 
 
@@ -229,6 +262,28 @@ trap_dispatch(struct Trapframe *tf)
 		return;
 	}
 
+	// The local APIC timer preempts user environments on every
+	// CPU, and the boot CPU keeps the time for all of them.
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER) {
+		lapic_eoi();
+		if (thiscpu == bootcpu)
+			vsys_tick();
+		sched_yield();
+		return;
+	}
+
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_ERROR) {
+		cprintf("CPU %d: local APIC error\n", cpunum());
+		lapic_eoi();
+		return;
+	}
+
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TLBFLUSH) {
+		tlb_shootdown_poll();
+		lapic_eoi();
+		return;
+	}
+
 	if (tf->tf_trapno == T_PGFLT) {
 		page_fault_handler(tf);
 		return;
@@ -246,13 +301,14 @@ trap_dispatch(struct Trapframe *tf)
 		return;
 	} 
 
+	// The RTC interrupt takes the place of the local APIC timer
+	// where there is none (see rtc_init), as with CONFIG_KSPACE.
 	if (tf->tf_trapno == IRQ_OFFSET + IRQ_CLOCK) {
 		// read RTC status reg just to recet the interrupt flag
 		(void)rtc_check_status();
 
 		// update time in memory
-		int32_t time = gettime();
-		vsys[VSYS_gettime] = time;
+		vsys_tick();
 
 		// send EndOfInterrupt with IRQ_CLOCK as value
 		pic_send_eoi(IRQ_CLOCK);
@@ -302,21 +358,43 @@ trap(struct Trapframe *tf)
 		cprintf("Incoming TRAP frame at %p\n", tf);
 	}
 
-	assert(curenv);
+	// Re-acquire the big kernel lock if we were halted in
+	// sched_halt()
+	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+		lock_kernel();
 
-	// Garbage collect if current enviroment is a zombie
-	if (curenv->env_status == ENV_DYING) {
-		env_free(curenv);
-		curenv = NULL;
-		sched_yield();
-	}
+#ifdef CONFIG_KSPACE
+	// Environments run in ring 0 in this configuration.
+	bool from_env = curenv != NULL;
+#else
+	bool from_env = (tf->tf_cs & 3) == 3;
+#endif
 
-	// Copy trap frame (which is currently on the stack)
-	// into 'curenv->env_tf', so that running the environment
-	// will restart at the trap point.
-	curenv->env_tf = *tf;
-	// The trapframe on the stack should be ignored from here on.
-	tf = &curenv->env_tf;
+	if (from_env) {
+		// Trapped from user mode.
+		assert(curenv);
+
+		// Garbage collect if current enviroment is a zombie
+		// (sched_yield frees it).
+		if (curenv->env_status == ENV_DYING)
+			sched_yield();
+
+		// Copy trap frame (which is currently on the stack)
+		// into 'curenv->env_tf', so that running the environment
+		// will restart at the trap point.
+		curenv->env_tf = *tf;
+		// The trapframe on the stack should be ignored from here on.
+		tf = &curenv->env_tf;
+
+		// Acquire the big kernel lock before doing any serious
+		// kernel work, except for the system calls that do their
+		// own locking, and for a TLB shootdown, whose sender may
+		// hold the lock while it waits.
+		if (!(tf->tf_trapno == T_SYSCALL &&
+		      syscall_is_parallel(tf->tf_regs.reg_eax)) &&
+		    tf->tf_trapno != IRQ_OFFSET + IRQ_TLBFLUSH)
+			lock_kernel();
+	}
 
 	// Record that tf is the last real trapframe so
 	// print_trapframe can print some additional information.
@@ -334,6 +412,69 @@ trap(struct Trapframe *tf)
 		sched_yield();
 }
 
+#ifndef CONFIG_KSPACE
+// Called by sysenter_handler in trapentry.S with the registers the
+// user passed in (see lib/syscall.c).  A system call that simply returns
+// a value to its caller runs right here, and sysenter_handler returns
+// to user mode with SYSEXIT, skipping the trap frame copy in trap() and
+// the IRET in env_run().  Any other call gets the trap frame that
+// "int $T_SYSCALL" would have produced and goes through trap().
+int32_t
+sysenter_syscall(uint32_t num, uint32_t a1, uint32_t a2, uint32_t a3,
+		 uint32_t a4, uint32_t eip, uint32_t esp, uint32_t eflags)
+{
+	struct Trapframe tf;
+	bool fast = syscall_is_fast(num);
+	int32_t ret = 0;
+
+	// Garbage collect if another CPU made us a zombie, as trap() does
+	// (sched_yield frees it).
+	if (curenv->env_status == ENV_DYING)
+		sched_yield();
+
+	if (fast) {
+		bool big = !syscall_is_parallel(num);
+
+		if (big)
+			lock_kernel();
+		ret = syscall(num, a1, a2, a3, a4, 0);
+		if (curenv->env_status == ENV_RUNNING) {
+			if (big)
+				unlock_kernel();
+			return ret;
+		}
+		// The env stopped itself or was killed by another CPU:
+		// save its state for whoever runs it next and reschedule.
+	}
+
+	memset(&tf, 0, sizeof(tf));
+	tf.tf_regs.reg_eax = num;
+	tf.tf_regs.reg_edx = a1;
+	tf.tf_regs.reg_ecx = a2;
+	tf.tf_regs.reg_ebx = a3;
+	tf.tf_regs.reg_edi = a4;
+	// SI carried the return address, but trap_dispatch() reads it as
+	// the fifth argument, which is 0 for any call made with SYSENTER.
+	tf.tf_regs.reg_esi = 0;
+	tf.tf_regs.reg_ebp = esp;
+	tf.tf_es = GD_UD | 3;
+	tf.tf_ds = GD_UD | 3;
+	tf.tf_trapno = T_SYSCALL;
+	tf.tf_eip = eip;
+	tf.tf_cs = GD_UT | 3;
+	tf.tf_eflags = eflags | FL_IF;
+	tf.tf_esp = esp;
+	tf.tf_ss = GD_UD | 3;
+
+	if (fast) {
+		curenv->env_tf = tf;
+		curenv->env_tf.tf_regs.reg_eax = ret;
+		sched_yield();
+	}
+	trap(&tf);
+	panic("sysenter_syscall: trap returned");
+}
+#endif
 
 void
 page_fault_handler(struct Trapframe *tf)
@@ -351,6 +492,35 @@ page_fault_handler(struct Trapframe *tf)
 
 	// LAB 8: Your code here.
 
+	// A write to a copy-on-write page, by an env that asked the kernel
+	// to handle these (see sys_env_set_kcow): copy the page right here
+	// instead of going through the user-level handler.
+	// Page syscalls run without the big kernel lock, so the address
+	// space is only stable under curenv's own lock.
+	pte_t *pte;
+	bool handled = false;
+	env_lock(curenv);
+	if (curenv->env_kcow && (tf->tf_err & FEC_WR) && fault_va < UTOP &&
+	    page_lookup(curenv->env_pgdir, (void *)fault_va, &pte) &&
+	    (*pte & PTE_COW) &&
+	    page_cow_break(curenv->env_pgdir, (void *)fault_va) == 0) {
+		handled = true;
+	}
+
+	// A write into a 4MB region whose page table is still shared
+	// since fork: give the env its own page table and retry.
+	// If the page itself is copy-on-write, the retry faults again
+	// and goes to the user-level handler below.
+	if (!handled && (tf->tf_err & FEC_WR) && fault_va < UTOP &&
+	    (curenv->env_pgdir[PDX(fault_va)] & PDE_PTSHARED) &&
+	    pgdir_unshare(curenv->env_pgdir, (void *)fault_va) == 0) {
+		handled = true;
+	}
+	env_unlock(curenv);
+	if (handled) {
+		env_run(curenv);
+	}
+
 	// page 95 of Programming on asm on platform x86-64 by Ruslan Ablyazov
 	// uint32_t error_code = tf->tf_err;
 	// if (error_code & PTE_P) {
@@ -425,13 +595,22 @@ page_fault_handler(struct Trapframe *tf)
 
 
 	struct UTrapframe *user_tf = (struct UTrapframe*)(user_trap_frame_addr - sizeof (struct UTrapframe));
-	user_mem_assert(curenv, user_tf, sizeof(struct UTrapframe), PTE_U | PTE_W);
+	// Keep the exception stack mapped while we write to it.
+	env_lock(curenv);
+	if (user_mem_check_locked(curenv, user_tf, sizeof(struct UTrapframe),
+				  PTE_U | PTE_W) < 0) {
+		env_unlock(curenv);
+		// Prints the message and destroys the environment.
+		user_mem_assert(curenv, user_tf, sizeof(struct UTrapframe),
+				PTE_U | PTE_W);
+	}
 	user_tf->utf_eflags = tf->tf_eflags;
 	user_tf->utf_eip = tf->tf_eip;
 	user_tf->utf_esp = tf->tf_esp;
 	user_tf->utf_err = tf->tf_err;
 	user_tf->utf_regs = tf->tf_regs;
 	user_tf->utf_fault_va = fault_va;
+	env_unlock(curenv);
 
 	// now allow to execute the user handler
 	tf->tf_esp = (uint32_t)user_tf;
@@ -0,0 +1,77 @@
+// Keeping the vsys page (see inc/vsyscall.h) up to date.
+
+#include <inc/assert.h>
+#include <inc/vsyscall.h>
+#include <inc/x86.h>
+
+#include <kern/cpu.h>
+#include <kern/tsc.h>
+#include <kern/vsyscall.h>
+
+// With this shift, mult * TSC frequency is the same for every CPU,
+// and a delta of about an hour still scales without overflow.
+#define VSYS_TSC_SHIFT	22
+
+static uint64_t
+vsys_get64(int slot)
+{
+	return (uint32_t) vsys[slot] | (uint64_t) (uint32_t) vsys[slot + 1] << 32;
+}
+
+static void
+vsys_set64(int slot, uint64_t val)
+{
+	vsys[slot] = (uint32_t) val;
+	vsys[slot + 1] = (uint32_t) (val >> 32);
+}
+
+// Start the vsys clock at wall-clock time 'unix_time', in seconds.
+// Called once on the boot CPU, after tsc_calibrate.
+void
+vsys_init(int32_t unix_time)
+{
+	static_assert(NCPU <= VSYS_NCPU);
+	// Slower TSCs would need a multiplier over 32 bits.
+	assert(cpu_freq >= 1000);
+
+	vsys[VSYS_gettime] = unix_time;
+	vsys[VSYS_tsc_khz] = cpu_freq;
+	vsys[VSYS_tsc_mult] = (1000000ULL << VSYS_TSC_SHIFT) / cpu_freq;
+	vsys[VSYS_tsc_shift] = VSYS_TSC_SHIFT;
+	vsys_set64(VSYS_tsc_base, read_tsc());
+	vsys_set64(VSYS_mono_base, 0);
+	vsys_set64(VSYS_boot_ns, (uint64_t) unix_time * 1000000000);
+}
+
+// Nanoseconds since boot at TSC value 'tsc'.  Only the CPU that
+// calls vsys_tick may use it, since it does not check vsys[VSYS_seq].
+uint64_t
+vsys_tsc_to_ns(uint64_t tsc)
+{
+	uint64_t delta = tsc - vsys_get64(VSYS_tsc_base);
+
+	return vsys_get64(VSYS_mono_base) +
+	       ((delta * (uint32_t) vsys[VSYS_tsc_mult]) >> vsys[VSYS_tsc_shift]);
+}
+
+// Count a scheduler tick and move the clock base up to now, so that the
+// TSC delta that readers scale stays small.  Called on every tick, by
+// one CPU only.  This is the only clock the kernel keeps after boot:
+// the wall-clock seconds follow from it, not from the RTC.
+void
+vsys_tick(void)
+{
+	uint64_t now = read_tsc();
+	uint64_t mono = vsys_tsc_to_ns(now);
+
+	vsys[VSYS_gettime] = (vsys_get64(VSYS_boot_ns) + mono) / 1000000000;
+
+	vsys[VSYS_seq]++;
+	__sync_synchronize();
+	vsys_set64(VSYS_tsc_base, now);
+	vsys_set64(VSYS_mono_base, mono);
+	__sync_synchronize();
+	vsys[VSYS_seq]++;
+
+	vsys[VSYS_ticks]++;
+}
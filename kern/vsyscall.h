@@ -1,6 +1,12 @@
 #ifndef JOS_KERN_VSYSCALL_H
 #define JOS_KERN_VSYSCALL_H
 
+#include <inc/types.h>
+
 extern int *vsys;
 
+void vsys_init(int32_t unix_time);
+void vsys_tick(void);
+uint64_t vsys_tsc_to_ns(uint64_t tsc);
+
 #endif
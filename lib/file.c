@@ -6,6 +6,15 @@
 
 union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 
+static envid_t
+fsenv(void)
+{
+	static envid_t fsenv;
+	if (fsenv == 0)
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	return fsenv;
+}
+
 // Send an inter-environment request to the file server, and wait for
 // a reply.  The request body should be in fsipcbuf, and parts of the
 // response may be written back to fsipcbuf.
@@ -15,17 +24,27 @@ union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 static int
 fsipc(unsigned type, void *dstva)
 {
-	static envid_t fsenv;
-	if (fsenv == 0)
-		fsenv = ipc_find_env(ENV_TYPE_FS);
-
 	static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
 
 	if (debug)
 		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
 
-	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
-	return ipc_recv(NULL, dstva, NULL);
+	return ipc_call(fsenv(), type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+			dstva, NULL);
+}
+
+// Send a short request to the file server without an argument page,
+// and wait for a reply.  The request body is the two words a0 and a1,
+// which the server reads as the start of its union Fsipc.  Only
+// requests whose body fits, and whose reply is just the result,
+// can be sent this way.
+static int
+fsipc_short(unsigned type, uint32_t a0, uint32_t a1)
+{
+	if (debug)
+		cprintf("[%08x] fsipc_short %d %08x %08x\n", thisenv->env_id, type, a0, a1);
+
+	return ipc_call_mr(fsenv(), type, a0, a1, 0);
 }
 
 static int devfile_flush(struct Fd *fd);
@@ -99,8 +118,7 @@ open(const char *path, int mode)
 static int
 devfile_flush(struct Fd *fd)
 {
-	fsipcbuf.flush.req_fileid = fd->fd_file.id;
-	return fsipc(FSREQ_FLUSH, NULL);
+	return fsipc_short(FSREQ_FLUSH, fd->fd_file.id, 0);
 }
 
 // Read at most 'n' bytes from 'fd' at the current position into 'buf'.
@@ -177,9 +195,7 @@ devfile_stat(struct Fd *fd, struct Stat *st)
 static int
 devfile_trunc(struct Fd *fd, off_t newsize)
 {
-	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
-	fsipcbuf.set_size.req_size = newsize;
-	return fsipc(FSREQ_SET_SIZE, NULL);
+	return fsipc_short(FSREQ_SET_SIZE, fd->fd_file.id, newsize);
 }
 
 
@@ -190,6 +206,6 @@ sync(void)
 	// Ask the file server to update the disk
 	// by writing any dirty blocks in the buffer cache.
 
-	return fsipc(FSREQ_SYNC, NULL);
+	return fsipc_short(FSREQ_SYNC, 0, 0);
 }
 
@@ -1,12 +1,10 @@
-// implement fork from user space
+// fork with copy-on-write: the kernel copies the address space and
+// usually breaks the copy-on-write sharing too, any copy-on-write
+// fault it passes up is handled here in user space
 
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW		0x800
-
 // extern volatile pte_t uvpt[];     // VA of "virtual page table"
 // extern volatile pde_t uvpd[];     // VA of current page directory
 // void _pgfault_upcall(void);	 // upcall reference
@@ -65,104 +63,17 @@ pgfault(struct UTrapframe *utf)
 }
 
 //
-// Map our virtual page pn (address pn*PGSIZE) into the target envid
-// at the same virtual address.  If the page is writable or copy-on-write,
-// the new mapping must be created copy-on-write, and then our mapping must be
-// marked copy-on-write as well.  (Exercise: Why do we need to mark ours
-// copy-on-write again if it was already copy-on-write at the beginning of
-// this function?)
-//
-// Returns: 0 on success, < 0 on error.
-// It is also OK to panic on error.
-//
-static int
-duppage(envid_t envid, unsigned pn)
-{
-
-	// LAB 9: Your code here.
-	void* va = (void *)(pn * PGSIZE);
-
-	pte_t entry = uvpt[pn];
-
-	int32_t retval = 0;
-	if (! (entry & PTE_W || entry & PTE_COW)
-	  || (entry & PTE_SHARE) ) {
-		// if the parents page is readonly or shared: [ (not (W or COW)) or (SHARE) ], then map it to child directly (preserve page flags)
-		retval = sys_page_map(thisenv->env_id, va, envid, va, entry & PTE_SYSCALL);
-		if (retval < 0) {
-			panic("sys_page_map: %d", retval);
-		}
-		return 0;
-	}
-
-	// If the page is writable or copy-on-write,
-	// the new mapping must be created copy-on-write, and then our mapping must be
-	// marked copy-on-write as well. 
-
-	// disable write
-	entry &= ~PTE_W;
-	// enable copy on write
-	entry |= PTE_COW;
-
-	// then map parents page to child
-	retval = sys_page_map(thisenv->env_id, va, envid, va, entry & PTE_SYSCALL);
-	if (retval < 0) {
-		panic("sys_page_map: %d", retval);
-	}
-
-	// remap the parents page to parent, so we get copy-on-write bit set
-	retval = sys_page_map(thisenv->env_id, va, thisenv->env_id, va, entry & PTE_SYSCALL);
-	if (retval < 0) {
-		panic("sys_page_map: %d", retval);
-	}
-
-	return 0;
-}
-
-
-
-static void duplicate_pages(int32_t envid)
-{
-	uint32_t va = 0;
-	for (va = 0; va < UTOP ; va += PGSIZE) {
-		uint32_t pde_index_debug = PDX(va);
-		uint32_t page_number = PGNUM(va);
-		uint32_t uvpd_entry = uvpd[pde_index_debug];
-		if ( !(uvpd_entry & PTE_P)) {
-			// just skip the whole page directory and assosiated page tables
-			va += PGSIZE * (NPTENTRIES - 1);
-			continue;
-		}
-		uint32_t low_addr = UXSTACKTOP - PGSIZE;
-		uint32_t high_addr = UXSTACKTOP;
-		if (low_addr <= (uint32_t)va && (uint32_t)va < high_addr) {
-			// dont let parent duplicate this. Child process gets a
-			// fresh page, not a duplicate at this address.
-			continue;
-		}
-		uint32_t uvpt_entry = uvpt[page_number];
-		if (uvpt_entry & PTE_P) {
-			duppage(envid, page_number);
-		}
-	}
-
-}
-
-//
-// User-level fork with copy-on-write.
-// Set up our page fault handler appropriately.
-// Create a child.
-// Copy our address space and page fault handler setup to the child.
-// Then mark the child as runnable and return.
+// Fork with copy-on-write.
+// Set up our page fault handler appropriately, then let the kernel
+// create a child with a copy-on-write copy of our address space,
+// a fresh user exception stack and our page fault handler setup.
+// Copy-on-write faults in both of us are resolved by pgfault above.
 //
 // Returns: child's envid to the parent, 0 to the child, < 0 on error.
 // It is also OK to panic on error.
 //
 // Hint:
-//   Use uvpd, uvpt, and duppage.
 //   Remember to fix "thisenv" in the child process.
-//   Neither user exception stack should ever be marked copy-on-write,
-//   so you must allocate a new page for the child's user exception stack.
 //
 envid_t
 fork(void)
@@ -170,30 +81,21 @@ fork(void)
 
 	// LAB 9: Your code here.
 	set_pgfault_handler(pgfault);
+	// Let the kernel break copy-on-write sharing on its own, which
+	// saves the upcall and four system calls per fault.  pgfault
+	// stays installed for any fault the kernel passes up.
+	sys_env_set_kcow(0, 1);
 
-	envid_t ret_envid = sys_exofork();
+	envid_t ret_envid = sys_fork();
 	if (ret_envid < 0) {
-		panic("Could not exofork");
+		panic("Could not fork: %i", ret_envid);
 	}
 	if (ret_envid == 0) {
-		// this is the child process, the parent must dedupp pages,
-		// child must set thisenv var and return its pid
+		// this is the child process, it must set thisenv var
+		// and return its pid
 		thisenv = &envs[ENVX(sys_getenvid())];
-		return ret_envid;
 	}
 
-
-	duplicate_pages(ret_envid);
-
-	// set entry point of page fault
-	sys_env_set_pgfault_upcall(ret_envid, _pgfault_upcall);
-
-	// alloc page for user exceptions in child process
-	sys_page_alloc(ret_envid, (void *)(UXSTACKTOP - PGSIZE), PTE_W | PTE_U);
-
-	// let the child start
-	sys_env_set_status(ret_envid, ENV_RUNNABLE);
-
 	return ret_envid;
 }
 
@@ -46,12 +46,12 @@ ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
 }
 
 // Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'toenv'.
-// This function keeps trying until it succeeds.
-// It should panic() on any error other than -E_IPC_NOT_RECV.
+// The kernel blocks us until 'toenv' receives the message, so there
+// is no need to retry.  Senders are served in FIFO order.
+// It should panic() on any error.
 //
 // Hint:
-//   Use sys_yield() to be CPU-friendly.
-//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   If 'pg' is null, pass sys_ipc_send a value that it will understand
 //   as meaning "no page".  (Zero is not the right value.)
 void
 ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
@@ -60,19 +60,117 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
 	if (!pg) {
 		pg = (void *)UTOP;
 	}
-	while(true) {
-		int32_t retval = sys_ipc_try_send(to_env, val, pg, perm);
-		if (retval == -E_IPC_NOT_RECV) {
-			// other process is not ready to receive
-			sys_yield();
-		} else if (retval == 0) {
-			// success
-			break;
-		} else {
-			// any other error
-			panic("ipc_send failed: %d", retval);
+	int32_t retval = sys_ipc_send(to_env, val, pg, perm);
+	if (retval < 0) {
+		panic("ipc_send failed: %d", retval);
+	}
+}
+
+// Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'to_env'
+// and wait for its reply, like ipc_send followed by ipc_recv, except
+// that only a reply from 'to_env' is accepted and the kernel switches
+// to 'to_env' directly.  'rcv_pg' and 'perm_store' are used for the
+// reply like 'pg' and 'perm_store' in ipc_recv.
+// Returns the value of the reply, or < 0 on error.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+	if (!pg) {
+		pg = (void *)UTOP;
+	}
+	if (!rcv_pg) {
+		rcv_pg = (void *)UTOP;
+	}
+	int32_t retval = sys_ipc_call(to_env, val, pg, perm, rcv_pg);
+	if (retval < 0) {
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return retval;
+	}
+
+	if (perm_store) {
+		*perm_store = thisenv->env_ipc_perm;
+	}
+	return thisenv->env_ipc_value;
+}
+
+// Reply to 'to_env' (unless it is 0) and receive the next message,
+// the server side of ipc_call.  The reply arguments are those of
+// ipc_send, the rest are those of ipc_recv.
+// Returns the value received, or < 0 on error, in which case
+// *from_env_store and *perm_store are set to 0.
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store)
+{
+	if (!pg) {
+		pg = (void *)UTOP;
+	}
+	if (!rcv_pg) {
+		rcv_pg = (void *)UTOP;
+	}
+	int32_t retval = sys_ipc_reply_wait(to_env, val, pg, perm, rcv_pg);
+	if (retval < 0) {
+		if (from_env_store) {
+			*from_env_store = 0;
+		}
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return retval;
+	}
+
+	if (from_env_store) {
+		*from_env_store = thisenv->env_ipc_from;
+	}
+	if (perm_store) {
+		*perm_store = thisenv->env_ipc_perm;
+	}
+	return thisenv->env_ipc_value;
+}
+
+// Like ipc_call, but the request is the IPC_NMR words w0..w3 and no
+// page is sent or received.  The receiver finds the words in
+// thisenv->env_ipc_mr, w0 is also its IPC value.
+// Returns the value of the reply, or < 0 on error.
+int32_t
+ipc_call_mr(envid_t to_env, uint32_t w0, uint32_t w1, uint32_t w2,
+	    uint32_t w3)
+{
+	int32_t retval = sys_ipc_call_mr(to_env, w0, w1, w2, w3);
+	if (retval < 0) {
+		return retval;
+	}
+	return thisenv->env_ipc_value;
+}
+
+// Like ipc_reply_wait, but the reply is the IPC_NMR words w0..w3 and
+// no page is sent.  The next message may still bring a page, which is
+// mapped where the previous ipc_reply_wait or ipc_recv asked for it.
+int32_t
+ipc_reply_wait_mr(envid_t to_env, uint32_t w0, uint32_t w1, uint32_t w2,
+		  uint32_t w3, envid_t *from_env_store, int *perm_store)
+{
+	int32_t retval = sys_ipc_reply_wait_mr(to_env, w0, w1, w2, w3);
+	if (retval < 0) {
+		if (from_env_store) {
+			*from_env_store = 0;
 		}
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return retval;
 	}
+
+	if (from_env_store) {
+		*from_env_store = thisenv->env_ipc_from;
+	}
+	if (perm_store) {
+		*perm_store = thisenv->env_ipc_perm;
+	}
+	return thisenv->env_ipc_value;
 }
 
 // Find the first environment of the given type.  We'll use this to
@@ -0,0 +1,172 @@
+// Single-producer single-consumer byte rings in shared memory.
+//
+// A ring occupies 1 + npages pages starting at a page-aligned address:
+// a header page followed by npages data pages.  All of them are mapped
+// PTE_SHARE, so a ring created before fork() or spawn() is shared with
+// the child at the same address, and one side can write while the
+// other reads without a system call per transfer.
+//
+// r_head and r_tail are free-running byte counters; the amount of data
+// in the ring is r_head - r_tail.  Only the producer advances r_head and
+// only the consumer advances r_tail.  A side that finds the ring empty
+// (or full) announces it in r_reader_waiting (r_writer_waiting) and
+// blocks in sys_notify_wait on its wakeup counter; the other side bumps
+// the counter and calls sys_notify_wake only when the flag is set, so
+// a busy ring costs no system calls at all.
+
+#include <inc/lib.h>
+
+#define debug 0
+
+struct Ring {
+	volatile uint32_t r_head;	// total bytes written
+	volatile uint32_t r_tail;	// total bytes read
+	volatile uint32_t r_reader_waiting;	// consumer is about to sleep
+	volatile uint32_t r_writer_waiting;	// producer is about to sleep
+	volatile uint32_t r_reader_wakeups;	// consumer sleeps on this
+	volatile uint32_t r_writer_wakeups;	// producer sleeps on this
+	volatile uint32_t r_closed;	// no more data will be written
+	uint32_t r_size;		// bytes of data pages, a power of 2
+};
+
+static uint8_t *
+ring_data(struct Ring *r)
+{
+	return (uint8_t *) r + PGSIZE;
+}
+
+// Create a ring at 'r' with 'npages' data pages, which must be
+// a power of 2.  Allocates 1 + npages pages starting at r.
+// Returns 0 on success, < 0 on error.
+int
+ring_create(struct Ring *r, size_t npages)
+{
+	uint8_t *va = (uint8_t *) r;
+	size_t i;
+	int res;
+
+	if ((uint32_t) r % PGSIZE || npages == 0 || (npages & (npages - 1)))
+		return -E_INVAL;
+
+	for (i = 0; i <= npages; i++)
+		if ((res = sys_page_alloc(0, va + i * PGSIZE,
+					  PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+			goto err;
+
+	r->r_size = npages * PGSIZE;
+	return 0;
+
+    err:
+	while (i-- > 0)
+		sys_page_unmap(0, va + i * PGSIZE);
+	return res;
+}
+
+// Sleep until the other side bumps *wakeups, unless 'ready' holds
+// once the wait has been announced in *waiting.  The counter is read
+// first and the barrier keeps the flag store from being reordered
+// after the test of 'ready', so a wakeup cannot be lost.
+#define RING_WAIT(wakeups, waiting, ready)				\
+	do {								\
+		uint32_t __seq = *(wakeups);				\
+		*(waiting) = 1;						\
+		__sync_synchronize();					\
+		if (!(ready))						\
+			sys_notify_wait((uint32_t *) (wakeups), __seq);	\
+		*(waiting) = 0;						\
+	} while (0)
+
+// Wake the other side if it is sleeping, or about to, on *wakeups.
+static void
+ring_notify(volatile uint32_t *wakeups, volatile uint32_t *waiting)
+{
+	__sync_synchronize();
+	if (*waiting) {
+		(*wakeups)++;
+		sys_notify_wake((uint32_t *) wakeups);
+	}
+}
+
+// Write all 'n' bytes from 'buf' to the ring, blocking while it is full.
+// The consumer is woken at most once per call, or once per wait for space.
+// Returns n, or -E_EOF if the ring has been closed.
+ssize_t
+ring_write(struct Ring *r, const void *buf, size_t n)
+{
+	const uint8_t *src = buf;
+	size_t done = 0;
+
+	while (done < n) {
+		uint32_t head = r->r_head;
+		uint32_t tail = r->r_tail;
+		uint32_t space = r->r_size - (head - tail);
+
+		if (r->r_closed)
+			return -E_EOF;
+		if (space == 0) {
+			ring_notify(&r->r_reader_wakeups, &r->r_reader_waiting);
+			RING_WAIT(&r->r_writer_wakeups, &r->r_writer_waiting,
+				  r->r_tail != tail || r->r_closed);
+			continue;
+		}
+
+		uint32_t off = head & (r->r_size - 1);
+		uint32_t m = MIN(MIN(space, n - done), r->r_size - off);
+		memmove(ring_data(r) + off, src + done, m);
+		done += m;
+		// The data must be visible before the new head.
+		__sync_synchronize();
+		r->r_head = head + m;
+	}
+
+	ring_notify(&r->r_reader_wakeups, &r->r_reader_waiting);
+	if (debug)
+		cprintf("[%08x] ring_write %d\n", thisenv->env_id, n);
+	return n;
+}
+
+// Read up to 'n' bytes from the ring into 'buf', blocking only while
+// the ring is empty.  Returns the number of bytes read, which is 0
+// only if the ring is empty and closed.
+ssize_t
+ring_read(struct Ring *r, void *buf, size_t n)
+{
+	uint8_t *dst = buf;
+	uint32_t head, tail;
+
+	while ((head = r->r_head) == (tail = r->r_tail)) {
+		if (r->r_closed)
+			return 0;
+		RING_WAIT(&r->r_reader_wakeups, &r->r_reader_waiting,
+			  r->r_head != head || r->r_closed);
+	}
+	// Read the data only after seeing the new head.
+	__sync_synchronize();
+
+	uint32_t avail = head - tail;
+	uint32_t off = tail & (r->r_size - 1);
+	uint32_t m = MIN(avail, n);
+	uint32_t first = MIN(m, r->r_size - off);
+	memmove(dst, ring_data(r) + off, first);
+	memmove(dst + first, ring_data(r), m - first);
+	__sync_synchronize();
+	r->r_tail = tail + m;
+
+	ring_notify(&r->r_writer_wakeups, &r->r_writer_waiting);
+	if (debug)
+		cprintf("[%08x] ring_read %d\n", thisenv->env_id, m);
+	return m;
+}
+
+// Mark the ring closed and wake up both sides.  The consumer can
+// still read the data that is left in the ring.
+void
+ring_close(struct Ring *r)
+{
+	r->r_closed = 1;
+	r->r_reader_wakeups++;
+	r->r_writer_wakeups++;
+	__sync_synchronize();
+	sys_notify_wake((uint32_t *) &r->r_reader_wakeups);
+	sys_notify_wake((uint32_t *) &r->r_writer_wakeups);
+}
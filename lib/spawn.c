@@ -5,8 +5,57 @@
 
 // Helper functions for spawn.
 static int init_stack(envid_t child, const char **argv, uintptr_t *init_esp);
+
 static int map_segment(envid_t child, uintptr_t va, size_t memsz,
 		       int fd, size_t filesz, off_t fileoffset, int perm);
+
+// Page operations are queued here and applied with one
+// sys_page_map_batch call per BATCH_NPAGES pages or so.
+#define BATCH_NPAGES	32
+static struct PageOp batch[2 * BATCH_NPAGES];
+static size_t batch_n;
+
+// Apply the queued page operations.
+static int
+batch_flush(void)
+{
+	int r = sys_page_map_batch(batch, batch_n);
+	batch_n = 0;
+	return r;
+}
+
+static int
+batch_add(int op, envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+	if (batch_n == sizeof(batch) / sizeof(batch[0])) {
+		int r = batch_flush();
+		if (r < 0)
+			return r;
+	}
+	batch[batch_n++] = (struct PageOp) {
+		.op = op, .srcenv = srcenv, .srcva = srcva,
+		.dstenv = dstenv, .dstva = dstva, .perm = perm
+	};
+	return 0;
+}
+
+static int
+batch_alloc(envid_t envid, void *va, int perm)
+{
+	return batch_add(PAGEOP_ALLOC, 0, NULL, envid, va, perm);
+}
+
+static int
+batch_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+	return batch_add(PAGEOP_MAP, srcenv, srcva, dstenv, dstva, perm);
+}
+
+static int
+batch_unmap(envid_t envid, void *va)
+{
+	return batch_add(PAGEOP_UNMAP, 0, NULL, envid, va, 0);
+}
 static int copy_shared_pages(envid_t child);
 
 // Spawn a child process from a program image loaded from the file system.
@@ -224,9 +273,11 @@ init_stack(envid_t child, const char **argv, uintptr_t *init_esp)
 
 	// Allocate the stack pages at UTEMP.
 	for (int i = 0; i < USTACKSIZE; i += PGSIZE) {
-		if ((r = sys_page_alloc(0, (void*) UTEMP + i, PTE_P|PTE_U|PTE_W)) < 0)
+		if ((r = batch_alloc(0, (void*) UTEMP + i, PTE_P|PTE_U|PTE_W)) < 0)
 			return r;
 	}
+	if ((r = batch_flush()) < 0)
+		return r;
 
 	//	* Initialize 'argv_store[i]' to point to argument string i,
 	//	  for all 0 <= i < argc.
@@ -260,11 +311,13 @@ init_stack(envid_t child, const char **argv, uintptr_t *init_esp)
 	// After completing the stack, map it into the child's address space
 	// and unmap it from ours!
 	for (int i = 0; i < USTACKSIZE; i += PGSIZE) {
-		if ((r = sys_page_map(0, UTEMP + i, child, (void*) (USTACKTOP - USTACKSIZE + i), PTE_P | PTE_U | PTE_W)) < 0)
+		if ((r = batch_map(0, UTEMP + i, child, (void*) (USTACKTOP - USTACKSIZE + i), PTE_P | PTE_U | PTE_W)) < 0)
 			goto error;
-		if ((r = sys_page_unmap(0, UTEMP + i)) < 0)
+		if ((r = batch_unmap(0, UTEMP + i)) < 0)
 			goto error;
 	}
+	if ((r = batch_flush()) < 0)
+		goto error;
 
 	return 0;
 
@@ -278,7 +331,7 @@ static int
 map_segment(envid_t child, uintptr_t va, size_t memsz,
 	int fd, size_t filesz, off_t fileoffset, int perm)
 {
-	int i, r;
+	int i, j, n, r;
 
 	//cprintf("map_segment %x+%x\n", va, memsz);
 
@@ -289,25 +342,37 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
 		fileoffset -= i;
 	}
 
-	for (i = 0; i < memsz; i += PGSIZE) {
+	for (i = 0; i < memsz; i += n * PGSIZE) {
 		if (i >= filesz) {
 			// allocate a blank page
-			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+			n = 1;
+			if ((r = batch_alloc(child, (void*) (va + i), perm)) < 0)
 				return r;
-		} else {
-			// from file
-			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+			continue;
+		}
+
+		// from file: read up to BATCH_NPAGES pages at UTEMP
+		// at a time, then move them all to the child
+		n = MIN(BATCH_NPAGES, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+		for (j = 0; j < n; j++)
+			if ((r = batch_alloc(0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
 				return r;
-			if ((r = seek(fd, fileoffset + i)) < 0)
+		if ((r = batch_flush()) < 0)
+			return r;
+		if ((r = seek(fd, fileoffset + i)) < 0)
+			return r;
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+			return r;
+		for (j = 0; j < n; j++) {
+			if ((r = batch_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
 				return r;
-			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+			if ((r = batch_unmap(0, UTEMP + j * PGSIZE)) < 0)
 				return r;
-			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
-				panic("spawn: sys_page_map data: %i", r);
-			sys_page_unmap(0, UTEMP);
 		}
+		if ((r = batch_flush()) < 0)
+			panic("spawn: sys_page_map data: %i", r);
 	}
-	return 0;
+	return batch_flush();
 }
 
 // Copy the mappings for shared pages into the child address space.
@@ -320,7 +385,14 @@ copy_shared_pages(envid_t child)
 		uint32_t pde_index_debug = PDX(va);
 		uint32_t page_number = PGNUM(va);
 		uint32_t uvpd_entry = uvpd[pde_index_debug];
-		if ( !(uvpd_entry & PTE_P)) {
+		if ( !(uvpd_entry & PTE_P) || (uvpd_entry & PTE_PS)) {
+			// a shared 4MB page is mapped as a whole
+			if ((uvpd_entry & PTE_P) && (uvpd_entry & PTE_SHARE)) {
+				int32_t retval = batch_map(thisenv->env_id, (void*)va, child, (void*)va, (uvpd_entry & PTE_SYSCALL) | PTE_PS);
+				if (retval < 0) {
+					panic("sys_page_map: %d", retval);
+				}
+			}
 			// just skip the whole page directory and assosiated page tables
 			va += PGSIZE * (NPTENTRIES - 1);
 			continue;
@@ -328,12 +400,16 @@ copy_shared_pages(envid_t child)
 		uint32_t uvpt_entry = uvpt[page_number];
 		if (uvpt_entry & PTE_P && uvpt_entry & PTE_SHARE) {
 			// if the page is present and shared
-			int32_t retval = sys_page_map(thisenv->env_id, (void*)va, child, (void*)va, uvpt_entry & PTE_SYSCALL);
+			int32_t retval = batch_map(thisenv->env_id, (void*)va, child, (void*)va, uvpt_entry & PTE_SYSCALL);
 			if (retval < 0) {
 				panic("sys_page_map: %d", retval);
 			}
 		}
 	}
+	int32_t retval = batch_flush();
+	if (retval < 0) {
+		panic("sys_page_map: %d", retval);
+	}
 	return 0;
 }
 
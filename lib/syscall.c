@@ -2,12 +2,55 @@
 
 #include <inc/syscall.h>
 #include <inc/lib.h>
+#include <inc/x86.h>
+
+#ifndef CONFIG_KSPACE
+// Can this CPU enter the kernel with SYSENTER?  Set on the first
+// system call: 1 if it can, 0 if not.
+static int sysenter_ok = -1;
+
+static int
+cpu_has_sysenter(void)
+{
+	uint32_t eax, edx;
+
+	cpuid(1, &eax, NULL, NULL, &edx);
+	// The Pentium Pro reports SEP but does not implement SYSENTER.
+	if (((eax >> 8) & 0xF) == 6 && ((eax >> 4) & 0xF) < 3 && (eax & 0xF) < 3)
+		return 0;
+	return (edx & CPUID_FEAT_SEP) != 0;
+}
+#endif
 
 static inline int32_t
 syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
 {
 	int32_t ret;
 
+#ifndef CONFIG_KSPACE
+	// Fast system call: SYSENTER has no room for a fifth argument,
+	// since SI and BP carry the return address and the stack pointer
+	// (see sysenter_handler in kern/trapentry.S).  SYSEXIT returns with
+	// CX and DX clobbered.  BP cannot be named as an operand, so it is
+	// saved and restored around the call.
+	if (sysenter_ok < 0)
+		sysenter_ok = cpu_has_sysenter();
+	if (a5 == 0 && sysenter_ok) {
+		asm volatile("pushl %%ebp\n"
+			     "movl %%esp, %%ebp\n"
+			     "leal 1f, %%esi\n"
+			     "sysenter\n"
+			     "1:\n"
+			     "popl %%ebp\n"
+			: "=a" (ret), "+d" (a1), "+c" (a2)
+			: "a" (num),
+			  "b" (a3),
+			  "D" (a4)
+			: "esi", "cc", "memory");
+		goto out;
+	}
+#endif
+
 	// Generic system call: pass system call number in AX,
 	// up to five parameters in DX, CX, BX, DI, SI.
 	// Interrupt kernel with T_SYSCALL.
@@ -31,6 +74,9 @@ syscall(int num, int check, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
 		  "S" (a5)
 		: "cc", "memory");
 
+#ifndef CONFIG_KSPACE
+    out:
+#endif
 	if(check && ret > 0)
 		panic("syscall %d returned %d (> 0)", num, ret);
 
@@ -90,8 +136,26 @@ sys_page_unmap(envid_t envid, void *va)
 	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
 }
 
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+	return syscall(SYS_page_map_batch, 1, (uint32_t) ops, n, 0, 0, 0);
+}
+
 // sys_exofork is inlined in lib.h
 
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+
+int
+sys_env_set_kcow(envid_t envid, int enable)
+{
+	return syscall(SYS_env_set_kcow, 1, envid, enable, 0, 0, 0);
+}
+
 int
 sys_env_set_status(envid_t envid, int status)
 {
@@ -116,6 +180,48 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
 	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
 }
 
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_send, 1, envid, value, (uint32_t) srcva, perm, 0);
+}
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *srcva, int perm, void *dstva)
+{
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) srcva, perm, (uint32_t) dstva);
+}
+
+int
+sys_ipc_reply_wait(envid_t envid, uint32_t value, void *srcva, int perm, void *dstva)
+{
+	return syscall(SYS_ipc_reply_wait, 0, envid, value, (uint32_t) srcva, perm, (uint32_t) dstva);
+}
+
+int
+sys_ipc_call_mr(envid_t envid, uint32_t w0, uint32_t w1, uint32_t w2, uint32_t w3)
+{
+	return syscall(SYS_ipc_call_mr, 0, envid, w0, w1, w2, w3);
+}
+
+int
+sys_ipc_reply_wait_mr(envid_t envid, uint32_t w0, uint32_t w1, uint32_t w2, uint32_t w3)
+{
+	return syscall(SYS_ipc_reply_wait_mr, 0, envid, w0, w1, w2, w3);
+}
+
+int
+sys_notify_wait(uint32_t *uaddr, uint32_t expected)
+{
+	return syscall(SYS_notify_wait, 0, (uint32_t) uaddr, expected, 0, 0, 0);
+}
+
+int
+sys_notify_wake(uint32_t *uaddr)
+{
+	return syscall(SYS_notify_wake, 0, (uint32_t) uaddr, 0, 0, 0, 0);
+}
+
 int
 sys_ipc_recv(void *dstva)
 {
@@ -125,4 +231,22 @@ sys_ipc_recv(void *dstva)
 int sys_gettime(void)
 {
 	return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
-}
\ No newline at end of file
+}
+
+int
+sys_env_set_nice(envid_t envid, int nice)
+{
+	return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0);
+}
+
+int
+sys_ring_setup(struct SysRing *r)
+{
+	return syscall(SYS_ring_setup, 1, (uint32_t) r, 0, 0, 0, 0);
+}
+
+int
+sys_ring_enter(uint32_t to_submit, uint32_t min_complete)
+{
+	return syscall(SYS_ring_enter, 0, to_submit, min_complete, 0, 0, 0);
+}
@@ -0,0 +1,60 @@
+// Batching system calls through the system call ring.
+//
+// sys_ring_setup gives an env one ring page (struct SysRing).  Calls
+// queued with sysring_prep are all made by a single sysring_submit,
+// which costs one trap instead of one per call, and their results are
+// picked up with sysring_reap.  Only calls that just return a value can
+// go through the ring; the kernel fails the others with -E_NOT_SUPP.
+
+#include <inc/lib.h>
+
+// Queue system call 'num' with its arguments on ring 'r'.
+// 'data' is handed back unchanged with the call's completion.
+// Returns 0, or -E_NO_MEM if the submission queue is full.
+int
+sysring_prep(struct SysRing *r, uint32_t num, uint32_t a1, uint32_t a2,
+	     uint32_t a3, uint32_t a4, uint32_t a5, uint32_t data)
+{
+	uint32_t tail = r->sq_tail;
+	struct SysRingSQE *sqe;
+
+	if (tail - r->sq_head == SYSRING_NSQE)
+		return -E_NO_MEM;
+
+	sqe = &r->sq[tail % SYSRING_NSQE];
+	sqe->sqe_num = num;
+	sqe->sqe_args[0] = a1;
+	sqe->sqe_args[1] = a2;
+	sqe->sqe_args[2] = a3;
+	sqe->sqe_args[3] = a4;
+	sqe->sqe_args[4] = a5;
+	sqe->sqe_data = data;
+	// The entry must be complete before the kernel can see it.
+	__sync_synchronize();
+	r->sq_tail = tail + 1;
+	return 0;
+}
+
+// Make all the calls queued on 'r', and fail unless at least
+// 'min_complete' completions are then waiting.
+// Returns the number of calls made, < 0 on error.
+int
+sysring_submit(struct SysRing *r, uint32_t min_complete)
+{
+	return sys_ring_enter(r->sq_tail - r->sq_head, min_complete);
+}
+
+// Take the oldest completion off 'r' into *cqe.
+// Returns false if there is none.
+bool
+sysring_reap(struct SysRing *r, struct SysRingCQE *cqe)
+{
+	uint32_t head = r->cq_head;
+
+	if (head == r->cq_tail)
+		return false;
+	__sync_synchronize();
+	*cqe = r->cq[head % SYSRING_NCQE];
+	r->cq_head = head + 1;
+	return true;
+}
@@ -1,5 +1,6 @@
 #include <inc/vsyscall.h>
 #include <inc/lib.h>
+#include <inc/x86.h>
 
 static inline int32_t
 vsyscall(int num)
@@ -18,3 +19,61 @@ int vsys_gettime(void)
 {
 	return vsyscall(VSYS_gettime);
 }
+
+static uint64_t
+vsys_get64(int slot)
+{
+	return (uint32_t) vsys[slot] | (uint64_t) (uint32_t) vsys[slot + 1] << 32;
+}
+
+// TSC frequency in kHz, as calibrated by the kernel.
+uint32_t
+vsys_tsc_khz(void)
+{
+	return vsys[VSYS_tsc_khz];
+}
+
+// Nanoseconds since boot, with TSC precision and no system call.
+uint64_t
+vsys_monotonic_ns(void)
+{
+	uint64_t tsc_base, mono_base;
+	uint32_t seq, mult, shift;
+
+	// Retry while the kernel is moving the base (see inc/vsyscall.h).
+	do {
+		seq = vsys[VSYS_seq];
+		__sync_synchronize();
+		tsc_base = vsys_get64(VSYS_tsc_base);
+		mono_base = vsys_get64(VSYS_mono_base);
+		mult = vsys[VSYS_tsc_mult];
+		shift = vsys[VSYS_tsc_shift];
+		__sync_synchronize();
+	} while ((seq & 1) || vsys[VSYS_seq] != seq);
+
+	return mono_base + (((read_tsc() - tsc_base) * mult) >> shift);
+}
+
+// Nanoseconds since the UNIX epoch, with TSC precision.
+uint64_t
+vsys_wallclock_ns(void)
+{
+	return vsys_get64(VSYS_boot_ns) + vsys_monotonic_ns();
+}
+
+// Scheduler ticks since boot.
+uint32_t
+vsys_ticks(void)
+{
+	return vsys[VSYS_ticks];
+}
+
+// Id of the env running on the CPU with local APIC id 'cpu',
+// 0 if it is idle.
+envid_t
+vsys_cpu_envid(int cpu)
+{
+	if (cpu < 0 || cpu >= VSYS_NCPU)
+		return 0;
+	return vsys[VSYS_cpu_envid + cpu];
+}
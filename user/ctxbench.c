@@ -0,0 +1,52 @@
+// Measure the cost of switching between two address spaces.
+// Two environments bounce a message back and forth with IPC, so each
+// round trip is two switches.  Compare the numbers before and after
+// a change to the switch path (run with CPUS=1 for stable results),
+// e.g. 'make run-ctxbench-nox CPUS=1' against the same with
+// CONFIG_PGE=n, which keeps no TLB entries across switches.
+// The cost of a system call that does no work is measured first,
+// for comparison.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define ROUNDS	10000
+
+void
+umain(int argc, char **argv)
+{
+	envid_t who;
+	uint64_t start, end;
+	uint32_t i;
+
+	start = read_tsc();
+	for (i = 0; i < ROUNDS; i++)
+		sys_getenvid();
+	end = read_tsc();
+
+	cprintf("ctxbench: %d null system calls, %llu cycles per call\n",
+		ROUNDS, (end - start) / ROUNDS);
+
+	if ((who = fork()) < 0)
+		panic("fork: %i", who);
+
+	if (who == 0) {
+		// Child: send every message straight back.
+		for (i = 0; i < ROUNDS; i++) {
+			uint32_t v = ipc_recv(&who, 0, 0);
+			ipc_send(who, v, 0, 0);
+		}
+		return;
+	}
+
+	start = read_tsc();
+	for (i = 0; i < ROUNDS; i++) {
+		ipc_send(who, i, 0, 0);
+		if (ipc_recv(0, 0, 0) != i)
+			panic("round %d: wrong reply", i);
+	}
+	end = read_tsc();
+
+	cprintf("ctxbench: %d round trips, %llu cycles per round trip\n",
+		ROUNDS, (end - start) / ROUNDS);
+}
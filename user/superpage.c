@@ -0,0 +1,75 @@
+// Map a 4MB page with sys_page_alloc(PTE_PS) and check that it behaves.
+
+#include <inc/lib.h>
+
+#define VA	((char *) 0x40000000)
+#define SHVA	((char *) 0x40800000)
+
+void
+umain(int argc, char **argv)
+{
+	int r, i;
+	envid_t pid;
+
+	if ((r = sys_page_alloc(0, VA + PGSIZE, PTE_P | PTE_U | PTE_W | PTE_PS)) != -E_INVAL)
+		panic("misaligned 4MB sys_page_alloc: %i", r);
+	if ((r = sys_page_alloc(0, VA, PTE_P | PTE_U | PTE_W | PTE_PS)) < 0)
+		panic("sys_page_alloc: %i", r);
+	if (!(uvpd[PDX(VA)] & PTE_PS))
+		panic("no 4MB page at %p: pde %08x", VA, uvpd[PDX(VA)]);
+
+	// The whole page is zeroed and writable.
+	for (i = 0; i < PTSIZE / PGSIZE; i++) {
+		if (*(uint32_t *) (VA + i * PGSIZE) != 0)
+			panic("page %d is not zeroed", i);
+		*(uint32_t *) (VA + i * PGSIZE) = i;
+	}
+	for (i = 0; i < PTSIZE / PGSIZE; i++)
+		if (*(uint32_t *) (VA + i * PGSIZE) != i)
+			panic("page %d reads back %d", i, *(uint32_t *) (VA + i * PGSIZE));
+
+	// It cannot be passed on page by page...
+	if ((r = sys_page_map(0, VA, 0, UTEMP, PTE_P | PTE_U)) != -E_INVAL)
+		panic("sys_page_map of a 4MB page: %i", r);
+
+	// ...and fork gives the child a copy of its own...
+	if ((pid = fork()) < 0)
+		panic("fork: %i", pid);
+	if (pid == 0) {
+		for (i = 0; i < PTSIZE / PGSIZE; i++)
+			if (*(uint32_t *) (VA + i * PGSIZE) != i)
+				panic("child: page %d reads back %d", i, *(uint32_t *) (VA + i * PGSIZE));
+		*(uint32_t *) (VA + PTSIZE - 4) = 0xdeadbeef;
+		exit();
+	}
+	wait(pid);
+	if (*(uint32_t *) (VA + PTSIZE - 4) != 0)
+		panic("child's write is visible in a private 4MB page");
+
+	// ...unless it has PTE_SHARE, which fork and sys_page_map(PTE_PS)
+	// pass on as a whole.
+	if ((r = sys_page_alloc(0, SHVA, PTE_P | PTE_U | PTE_W | PTE_PS | PTE_SHARE)) < 0)
+		panic("sys_page_alloc(PTE_SHARE): %i", r);
+	if ((r = sys_page_map(0, SHVA, 0, SHVA + PTSIZE, PTE_P | PTE_U | PTE_W | PTE_PS)) < 0)
+		panic("sys_page_map(PTE_PS): %i", r);
+	*(uint32_t *) (SHVA + PTSIZE + PGSIZE) = 0x1234;
+	if (*(uint32_t *) (SHVA + PGSIZE) != 0x1234)
+		panic("4MB alias does not share its memory");
+	if ((pid = fork()) < 0)
+		panic("fork: %i", pid);
+	if (pid == 0) {
+		*(uint32_t *) (SHVA + PTSIZE - 4) = 0xdeadbeef;
+		exit();
+	}
+	wait(pid);
+	if (*(uint32_t *) (SHVA + PTSIZE - 4) != 0xdeadbeef)
+		panic("child's write is not visible in a shared 4MB page");
+
+	// Unmapping any part of it unmaps all of it.
+	if ((r = sys_page_unmap(0, VA + 5 * PGSIZE)) < 0)
+		panic("sys_page_unmap: %i", r);
+	if (uvpd[PDX(VA)] & PTE_P)
+		panic("4MB page still mapped: pde %08x", uvpd[PDX(VA)]);
+
+	cprintf("superpage ok\n");
+}
@@ -0,0 +1,19 @@
+// Print the system call statistics the kernel keeps at USYSSTATS.
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	uint32_t timed, i, j;
+
+	cprintf("%4s %10s %10s %12s\n", "num", "calls", "timed", "avg cycles");
+	for (i = 0; i < NSYSCALLS; i++) {
+		if (sysstats[i].sc_count == 0)
+			continue;
+		for (timed = 0, j = 0; j < NSYSHIST; j++)
+			timed += sysstats[i].sc_hist[j];
+		cprintf("%4d %10u %10u %12llu\n", i, sysstats[i].sc_count,
+			timed, timed ? sysstats[i].sc_cycles / timed : 0);
+	}
+}
@@ -0,0 +1,60 @@
+// Exercise sys_ipc_call and sys_ipc_reply_wait.
+
+#include <inc/lib.h>
+
+#define NCALLS	100
+
+// Reply to every request with its value plus one.
+// A request with value 0 makes the server exit without replying.
+static void
+server(void)
+{
+	envid_t whom = 0, client;
+	int32_t req, r = 0;
+
+	while (1) {
+		client = whom;
+		req = ipc_reply_wait(client, r, NULL, 0, &whom, NULL, NULL);
+		if (req == -E_IPC_NOT_RECV) {
+			// The client is not in ipc_recv yet.
+			if ((r = sys_ipc_send(client, r, (void *) UTOP, 0)) < 0)
+				panic("server: sys_ipc_send: %i", r);
+			whom = 0;
+			continue;
+		}
+		if (req < 0)
+			panic("server: ipc_reply_wait: %i", req);
+		if (req == 0)
+			exit();
+		r = req + 1;
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t srv, from;
+	int32_t i, r;
+
+	if ((srv = fork()) < 0)
+		panic("fork: %i", srv);
+	if (srv == 0) {
+		server();
+		return;
+	}
+
+	for (i = 1; i <= NCALLS; i++)
+		if ((r = ipc_call(srv, i, NULL, 0, NULL, NULL)) != i + 1)
+			panic("ipc_call(%d): %i, want %d", i, r, i + 1);
+
+	// A client that sends and then receives gets its reply too.
+	ipc_send(srv, 1000, NULL, 0);
+	if ((r = ipc_recv(&from, NULL, NULL)) != 1001 || from != srv)
+		panic("ipc_recv: %i from %08x, want 1001 from %08x", r, from, srv);
+
+	// A server that exits fails the call waiting for its reply.
+	if ((r = ipc_call(srv, 0, NULL, 0, NULL, NULL)) != -E_BAD_ENV)
+		panic("ipc_call to an exiting server: %i, want %i", r, -E_BAD_ENV);
+
+	cprintf("ipc_call ok\n");
+}
@@ -0,0 +1,56 @@
+// Exercise the blocking sys_ipc_send: senders queue up in the kernel
+// in FIFO order until the receiver gets to them.
+
+#include <inc/lib.h>
+
+#define NSENDERS	3
+
+// Yield until env 'id' has blocked in the kernel.
+static void
+wait_blocked(envid_t id)
+{
+	while (envs[ENVX(id)].env_status != ENV_NOT_RUNNABLE)
+		sys_yield();
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t parent = thisenv->env_id, kids[NSENDERS], who, from;
+	int i, r;
+
+	if ((r = sys_ipc_send(parent, 0, (void *) UTOP, 0)) != -E_INVAL)
+		panic("sys_ipc_send to self: %i, want %i", r, -E_INVAL);
+
+	// Start the senders one by one, so that they queue in order.
+	for (i = 0; i < NSENDERS; i++) {
+		if ((who = fork()) < 0)
+			panic("fork: %i", who);
+		if (who == 0) {
+			if ((r = sys_ipc_send(parent, 100 + i, (void *) UTOP, 0)) < 0)
+				panic("sender %d: sys_ipc_send: %i", i, r);
+			return;
+		}
+		kids[i] = who;
+		wait_blocked(who);
+	}
+
+	for (i = 0; i < NSENDERS; i++) {
+		if ((r = ipc_recv(&from, NULL, NULL)) != 100 + i)
+			panic("message %d: %d, want %d", i, r, 100 + i);
+		if (from != kids[i])
+			panic("message %d from %08x, want %08x", i, from, kids[i]);
+	}
+
+	// A blocked sender fails when its receiver exits.
+	if ((who = fork()) < 0)
+		panic("fork: %i", who);
+	if (who == 0) {
+		wait_blocked(parent);
+		return;
+	}
+	if ((r = sys_ipc_send(who, 1, (void *) UTOP, 0)) != -E_BAD_ENV)
+		panic("sys_ipc_send to an exiting env: %i, want %i", r, -E_BAD_ENV);
+
+	cprintf("ipc send ok\n");
+}
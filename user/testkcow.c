@@ -0,0 +1,85 @@
+// Check that with sys_env_set_kcow the kernel resolves copy-on-write
+// faults itself, and that without it they still reach the upcall.
+
+#include <inc/lib.h>
+
+#define FLAG	((volatile int *) 0xA0000000)
+
+static volatile int value;
+static volatile int upcalls;
+
+// Resolve a copy-on-write fault the way lib/fork.c does.
+static void
+handler(struct UTrapframe *utf)
+{
+	void *addr = ROUNDDOWN((void *) utf->utf_fault_va, PGSIZE);
+	int r;
+
+	if (!(utf->utf_err & FEC_WR) || !(uvpt[PGNUM(addr)] & PTE_COW))
+		panic("unexpected fault at %08x, err %x", utf->utf_fault_va,
+		      utf->utf_err);
+	if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("sys_page_alloc: %i", r);
+	memmove(PFTEMP, addr, PGSIZE);
+	if ((r = sys_page_map(0, PFTEMP, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("sys_page_map: %i", r);
+	if ((r = sys_page_unmap(0, PFTEMP)) < 0)
+		panic("sys_page_unmap: %i", r);
+	upcalls++;
+}
+
+// Fork with sys_fork and have parent and child both write 'value'
+// while the other still maps it.  Returns in the parent only.
+static void
+run(int kcow)
+{
+	envid_t child;
+	int r;
+
+	if ((r = sys_env_set_kcow(0, kcow)) < 0)
+		panic("sys_env_set_kcow: %i", r);
+	value = 1;
+	upcalls = 0;
+	*FLAG = 0;
+
+	if ((child = sys_fork()) < 0)
+		panic("sys_fork: %i", child);
+	if (child == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		while (*FLAG != 1)
+			sys_yield();
+		if (value != 1)
+			panic("child: value %d before writing, want 1", value);
+		value = 2;
+		if (!kcow != !!upcalls)
+			panic("child: %d upcalls with kcow %d", upcalls, kcow);
+		*FLAG = 2;
+		exit();
+	}
+
+	value = 3;
+	*FLAG = 1;
+	while (*FLAG != 2)
+		sys_yield();
+	wait(child);
+	if (value != 3)
+		panic("parent: value %d, want 3", value);
+	if (!(uvpt[PGNUM(&value)] & PTE_W) || (uvpt[PGNUM(&value)] & PTE_COW))
+		panic("parent: pte %08x after the write", uvpt[PGNUM(&value)]);
+	if (!kcow != !!upcalls)
+		panic("parent: %d upcalls with kcow %d", upcalls, kcow);
+}
+
+void
+umain(int argc, char **argv)
+{
+	int r;
+
+	if ((r = sys_page_alloc(0, (void *) FLAG, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %i", r);
+	set_pgfault_handler(handler);
+
+	run(1);
+	run(0);
+	cprintf("kernel cow ok\n");
+}
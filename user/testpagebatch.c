@@ -0,0 +1,80 @@
+// Exercise sys_page_map_batch.
+
+#include <inc/lib.h>
+
+#define SRC	((char *) 0xA0000000)
+#define DST	((char *) 0xA0800000)
+#define NPAGES	40	// More than one chunk of operations in the kernel
+
+static struct PageOp ops[3 * NPAGES];
+
+void
+umain(int argc, char **argv)
+{
+	envid_t child;
+	int i, n, r;
+
+	// Allocate, alias, and unmap the originals, all in one call.
+	n = 0;
+	for (i = 0; i < NPAGES; i++)
+		ops[n++] = (struct PageOp) { PAGEOP_ALLOC, 0, 0, 0,
+					     SRC + i * PGSIZE, PTE_P | PTE_U | PTE_W };
+	for (i = 0; i < NPAGES; i++)
+		ops[n++] = (struct PageOp) { PAGEOP_MAP, 0, SRC + i * PGSIZE, 0,
+					     DST + i * PGSIZE, PTE_P | PTE_U | PTE_W };
+	if ((r = sys_page_map_batch(ops, n)) < 0)
+		panic("sys_page_map_batch: %i", r);
+	for (i = 0; i < NPAGES; i++) {
+		if (*(int *) (DST + i * PGSIZE) != 0)
+			panic("page %d is not zeroed", i);
+		*(int *) (SRC + i * PGSIZE) = i;
+		if (*(int *) (DST + i * PGSIZE) != i)
+			panic("page %d: alias reads %d", i, *(int *) (DST + i * PGSIZE));
+	}
+
+	n = 0;
+	for (i = 0; i < NPAGES; i++)
+		ops[n++] = (struct PageOp) { PAGEOP_UNMAP, 0, 0, 0,
+					     SRC + i * PGSIZE, 0 };
+	if ((r = sys_page_map_batch(ops, n)) < 0)
+		panic("sys_page_map_batch: %i", r);
+	for (i = 0; i < NPAGES; i++) {
+		if (uvpt[PGNUM(SRC + i * PGSIZE)] & PTE_P)
+			panic("page %d still mapped", i);
+		if (*(int *) (DST + i * PGSIZE) != i)
+			panic("page %d lost: reads %d", i, *(int *) (DST + i * PGSIZE));
+	}
+
+	// Processing stops at the first failing operation, and the
+	// operations before it stay applied.
+	ops[0] = (struct PageOp) { PAGEOP_ALLOC, 0, 0, 0, SRC, PTE_P | PTE_U | PTE_W };
+	ops[1] = (struct PageOp) { PAGEOP_ALLOC, 0, 0, 0, SRC + 1, PTE_P | PTE_U | PTE_W };
+	ops[2] = (struct PageOp) { PAGEOP_ALLOC, 0, 0, 0, SRC + 2 * PGSIZE, PTE_P | PTE_U | PTE_W };
+	if ((r = sys_page_map_batch(ops, 3)) != -E_INVAL)
+		panic("batch with a misaligned page: %i, want %i", r, -E_INVAL);
+	if (!(uvpt[PGNUM(SRC)] & PTE_P) || (uvpt[PGNUM(SRC + 2 * PGSIZE)] & PTE_P))
+		panic("batch did not stop at the failing operation");
+	ops[0].op = 42;
+	if ((r = sys_page_map_batch(ops, 1)) != -E_INVAL)
+		panic("batch with a bad operation: %i, want %i", r, -E_INVAL);
+	if ((r = sys_page_map_batch((struct PageOp *) ULIM, 1)) != -E_FAULT)
+		panic("batch from kernel memory: %i, want %i", r, -E_FAULT);
+
+	// Batches may work on another env, as spawn does.
+	if ((child = fork()) < 0)
+		panic("fork: %i", child);
+	if (child == 0) {
+		while (!(uvpd[PDX(UTEMP)] & PTE_P) || !(uvpt[PGNUM(UTEMP)] & PTE_P))
+			sys_yield();
+		if (*(int *) UTEMP != 7)
+			panic("child: page reads %d, want 7", *(int *) UTEMP);
+		return;
+	}
+	*(int *) DST = 7;
+	ops[0] = (struct PageOp) { PAGEOP_MAP, 0, DST, child, UTEMP, PTE_P | PTE_U };
+	if ((r = sys_page_map_batch(ops, 1)) < 0)
+		panic("sys_page_map_batch into the child: %i", r);
+	wait(child);
+
+	cprintf("page map batch ok\n");
+}
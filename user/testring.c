@@ -0,0 +1,52 @@
+// Stream data through a shared ring from a parent to its child.
+
+#include <inc/lib.h>
+
+#define RING_VA		((struct Ring *) 0xB0000000)
+#define RING_NPAGES	2
+#define TOTAL		(64 * 1024)
+
+static uint8_t buf[3000];
+
+void
+umain(int argc, char **argv)
+{
+	int r, pid;
+	uint32_t i, n;
+
+	if ((r = ring_create(RING_VA, RING_NPAGES)) < 0)
+		panic("ring_create: %i", r);
+
+	if ((pid = fork()) < 0)
+		panic("fork: %i", pid);
+
+	if (pid == 0) {
+		// Child: read everything back and check the pattern.
+		n = 0;
+		while ((r = ring_read(RING_VA, buf, sizeof(buf))) > 0) {
+			for (i = 0; i < r; i++, n++)
+				if (buf[i] != (uint8_t) (n * 7))
+					panic("byte %d is %02x, want %02x",
+					      n, buf[i], (uint8_t) (n * 7));
+		}
+		if (r < 0)
+			panic("ring_read: %i", r);
+		if (n != TOTAL)
+			panic("read %d bytes, want %d", n, TOTAL);
+		cprintf("ring read ok\n");
+		exit();
+	}
+
+	// Parent: write in odd-sized chunks so the ring wraps around.
+	for (n = 0; n < TOTAL; ) {
+		uint32_t m = MIN(sizeof(buf), TOTAL - n);
+		for (i = 0; i < m; i++)
+			buf[i] = (uint8_t) ((n + i) * 7);
+		if ((r = ring_write(RING_VA, buf, m)) != m)
+			panic("ring_write: %i", r);
+		n += m;
+	}
+	ring_close(RING_VA);
+	wait(pid);
+	cprintf("ring write ok\n");
+}
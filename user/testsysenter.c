@@ -0,0 +1,154 @@
+// Exercise the SYSENTER system call path: the fast return with SYSEXIT,
+// the fallback through trap() for calls that block, and a fast call
+// that stops its own env.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define SENTINEL_B	0x5a5a1234
+#define SENTINEL_D	0xa5a54321
+
+// Make system call 'num' with SYSENTER, the way lib/syscall.c does, and
+// hand back BX and DI as they are after SYSEXIT.
+static int32_t
+raw_sysenter(int num, uint32_t a1, uint32_t a2, uint32_t *a3, uint32_t *a4)
+{
+	uint32_t b = *a3, d = *a4;
+	int32_t ret;
+
+	asm volatile("pushl %%ebp\n"
+		     "movl %%esp, %%ebp\n"
+		     "leal 1f, %%esi\n"
+		     "sysenter\n"
+		     "1:\n"
+		     "popl %%ebp\n"
+		: "=a" (ret), "+d" (a1), "+c" (a2), "+b" (b), "+D" (d)
+		: "a" (num)
+		: "esi", "cc", "memory");
+	*a3 = b;
+	*a4 = d;
+	return ret;
+}
+
+// Make system call 'num' with SYSENTER and check that BX and DI survive.
+static int32_t
+checked_sysenter(const char *what, int num, uint32_t a1, uint32_t a2)
+{
+	uint32_t b = SENTINEL_B, d = SENTINEL_D;
+	int32_t r;
+
+	r = raw_sysenter(num, a1, a2, &b, &d);
+	if (b != SENTINEL_B || d != SENTINEL_D)
+		panic("%s: bx %08x di %08x after sysexit", what, b, d);
+	return r;
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t parent = thisenv->env_id, child, from;
+	uint32_t edx;
+	int i, r;
+
+	cpuid(1, NULL, NULL, NULL, &edx);
+	if (!(edx & CPUID_FEAT_SEP)) {
+		cprintf("no SYSENTER on this CPU, skipping\n");
+		return;
+	}
+
+	// Fast calls return straight to the caller.
+	for (i = 0; i < 1000; i++)
+		if ((r = checked_sysenter("getenvid", SYS_getenvid, 0, 0)) != parent)
+			panic("sys_getenvid: %08x, want %08x", r, parent);
+	if ((r = checked_sysenter("page_alloc", SYS_page_alloc, 0, (uint32_t) UTEMP)) != -E_INVAL)
+		panic("sys_page_alloc with a bad perm: %i, want %i", r, -E_INVAL);
+	if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("sys_page_alloc: %i", r);
+	*(int *) UTEMP = 17;
+
+	// A five-argument call cannot use SYSENTER and goes through
+	// int $T_SYSCALL instead.
+	if ((r = sys_page_map(0, UTEMP, 0, UTEMP + PGSIZE, PTE_P | PTE_U)) < 0)
+		panic("sys_page_map: %i", r);
+	if (*(int *) (UTEMP + PGSIZE) != 17)
+		panic("sys_page_map: alias reads %d", *(int *) (UTEMP + PGSIZE));
+	if ((r = checked_sysenter("page_unmap", SYS_page_unmap, 0, (uint32_t) (UTEMP + PGSIZE))) < 0)
+		panic("sys_page_unmap: %i", r);
+	if (uvpt[PGNUM(UTEMP + PGSIZE)] & PTE_P)
+		panic("sys_page_unmap left the page mapped");
+
+	// Calls that switch envs save a trap frame and come back by IRET.
+	for (i = 0; i < 100; i++)
+		checked_sysenter("yield", SYS_yield, 0, 0);
+
+	// A blocking receive is resumed with the sender's value.
+	if ((child = fork()) < 0)
+		panic("fork: %i", child);
+	if (child == 0) {
+		while (envs[ENVX(parent)].env_status != ENV_NOT_RUNNABLE)
+			sys_yield();
+		ipc_send(parent, 42, NULL, 0);
+		return;
+	}
+	if ((r = ipc_recv(&from, NULL, NULL)) != 42 || from != child)
+		panic("ipc_recv: %i from %08x, want 42 from %08x", r, from, child);
+	wait(child);
+
+	// Blocking calls made with SYSENTER get 0 as their fifth argument,
+	// here the last message word, in both directions.
+	if ((child = fork()) < 0)
+		panic("fork: %i", child);
+	if (child == 0) {
+		if ((r = ipc_recv(&from, NULL, NULL)) != 5 || from != parent)
+			panic("child: ipc_recv: %i from %08x, want 5 from %08x",
+			      r, from, parent);
+		if (thisenv->env_ipc_mr[1] != 6 || thisenv->env_ipc_mr[2] != 7 ||
+		    thisenv->env_ipc_mr[3] != 0)
+			panic("child: request words %x %x %x, want 6 7 0",
+			      thisenv->env_ipc_mr[1], thisenv->env_ipc_mr[2],
+			      thisenv->env_ipc_mr[3]);
+		ipc_reply_wait_mr(parent, 8, 9, 10, 0, NULL, NULL);
+		panic("child: ipc_reply_wait_mr returned");
+	}
+	if ((r = ipc_call_mr(child, 5, 6, 7, 0)) != 8)
+		panic("ipc_call_mr: %i, want 8", r);
+	if (thisenv->env_ipc_mr[1] != 9 || thisenv->env_ipc_mr[2] != 10 ||
+	    thisenv->env_ipc_mr[3] != 0)
+		panic("reply words %x %x %x, want 9 10 0", thisenv->env_ipc_mr[1],
+		      thisenv->env_ipc_mr[2], thisenv->env_ipc_mr[3]);
+	if ((r = sys_env_destroy(child)) < 0)
+		panic("sys_env_destroy: %i", r);
+	wait(child);
+
+	// A fast call that stops the caller saves its registers
+	// for when it runs again.
+	if ((child = fork()) < 0)
+		panic("fork: %i", child);
+	if (child == 0) {
+		if ((r = checked_sysenter("env_set_status", SYS_env_set_status,
+					  0, ENV_NOT_RUNNABLE)) < 0)
+			panic("child: sys_env_set_status: %i", r);
+		return;
+	}
+	while (envs[ENVX(child)].env_status != ENV_NOT_RUNNABLE)
+		sys_yield();
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+		panic("sys_env_set_status: %i", r);
+	wait(child);
+
+	// An env destroyed while it makes SYSENTER calls,
+	// maybe on another CPU, still goes away.
+	if ((child = fork()) < 0)
+		panic("fork: %i", child);
+	if (child == 0) {
+		while (1)
+			checked_sysenter("getenvid", SYS_getenvid, 0, 0);
+	}
+	for (i = 0; i < 10; i++)
+		sys_yield();
+	if ((r = sys_env_destroy(child)) < 0)
+		panic("sys_env_destroy: %i", r);
+	wait(child);
+
+	cprintf("sysenter ok\n");
+}
@@ -0,0 +1,86 @@
+// Check that sys_fork gives the child a private copy of the address
+// space, with PTE_SHARE pages still shared, in both directions.
+
+#include <inc/lib.h>
+
+#define REGION	((volatile int *) 0xA0000000)
+#define NPAGES	64
+#define SHARED	((volatile int *) 0xA0400000)
+
+static volatile int data = 1;
+static volatile int bss;
+
+static void
+fill(int base)
+{
+	int i;
+
+	for (i = 0; i < NPAGES; i++)
+		REGION[i * PGSIZE / sizeof(int)] = base + i;
+}
+
+static void
+check(const char *who, int base)
+{
+	int i;
+
+	for (i = 0; i < NPAGES; i++)
+		if (REGION[i * PGSIZE / sizeof(int)] != base + i)
+			panic("%s: page %d reads %d, want %d", who, i,
+			      REGION[i * PGSIZE / sizeof(int)], base + i);
+}
+
+void
+umain(int argc, char **argv)
+{
+	volatile int stack = 3;
+	envid_t child;
+	int i, r;
+
+	for (i = 0; i < NPAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (REGION + i * PGSIZE / sizeof(int)),
+					PTE_P | PTE_U | PTE_W)) < 0)
+			panic("sys_page_alloc: %i", r);
+	if ((r = sys_page_alloc(0, (void *) SHARED, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %i", r);
+	fill(1000);
+	bss = 2;
+
+	if ((child = fork()) < 0)
+		panic("fork: %i", child);
+	if (child == 0) {
+		if (data != 1 || bss != 2 || stack != 3)
+			panic("child: data %d bss %d stack %d", data, bss, stack);
+		check("child", 1000);
+		fill(2000);
+		data = bss = stack = 0;
+		*SHARED = 42;
+		return;
+	}
+
+	wait(child);
+	if (data != 1 || bss != 2 || stack != 3)
+		panic("parent: data %d bss %d stack %d after the child wrote", data, bss, stack);
+	check("parent", 1000);
+	if (*SHARED != 42)
+		panic("PTE_SHARE page is not shared: %d", *SHARED);
+
+	// The parent's writes stay private as well.
+	if ((child = fork()) < 0)
+		panic("fork: %i", child);
+	if (child == 0) {
+		while (*SHARED != 43)
+			sys_yield();
+		check("second child", 1000);
+		*SHARED = 44;
+		return;
+	}
+	fill(3000);
+	*SHARED = 43;
+	wait(child);
+	if (*SHARED != 44)
+		panic("second child failed");
+	check("parent", 3000);
+
+	cprintf("sys_fork ok\n");
+}
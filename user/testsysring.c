@@ -0,0 +1,64 @@
+// Make a batch of system calls through the system call ring.
+
+#include <inc/lib.h>
+
+#define SYSRING_VA	((struct SysRing *) 0xB0000000)
+#define NPAGES		32
+
+void
+umain(int argc, char **argv)
+{
+	struct SysRing *r = SYSRING_VA;
+	struct SysRingCQE cqe;
+	int res, i, n;
+
+	if ((res = sys_ring_setup(r)) < 0)
+		panic("sys_ring_setup: %i", res);
+	if ((res = sys_ring_setup(r)) != -E_INVAL)
+		panic("second sys_ring_setup: %i, want %i", res, -E_INVAL);
+
+	for (i = 0; i < NPAGES; i++)
+		if ((res = sysring_prep(r, SYS_page_alloc, 0,
+					(uint32_t) UTEMP + i * PGSIZE,
+					PTE_P | PTE_U | PTE_W, 0, 0, i)) < 0)
+			panic("sysring_prep: %i", res);
+	sysring_prep(r, SYS_getenvid, 0, 0, 0, 0, 0, NPAGES);
+	// Blocking calls cannot be made from the ring.
+	sysring_prep(r, SYS_yield, 0, 0, 0, 0, 0, NPAGES + 1);
+
+	// Everything completes right away, so asking for more fails.
+	if ((res = sysring_submit(r, NPAGES + 3)) != -E_INVAL)
+		panic("sysring_submit(%d): %i, want %i", NPAGES + 3, res, -E_INVAL);
+	if ((res = sysring_submit(r, NPAGES + 2)) != NPAGES + 2)
+		panic("sysring_submit: %i, want %d", res, NPAGES + 2);
+
+	for (n = 0; sysring_reap(r, &cqe); n++) {
+		if (cqe.cqe_data != n)
+			panic("completion %d has data %d", n, cqe.cqe_data);
+		if (n < NPAGES && cqe.cqe_res != 0)
+			panic("page_alloc %d: %i", n, cqe.cqe_res);
+		if (n == NPAGES && cqe.cqe_res != thisenv->env_id)
+			panic("getenvid: %08x, want %08x", cqe.cqe_res, thisenv->env_id);
+		if (n == NPAGES + 1 && cqe.cqe_res != -E_NOT_SUPP)
+			panic("yield: %i, want %i", cqe.cqe_res, -E_NOT_SUPP);
+	}
+	if (n != NPAGES + 2)
+		panic("reaped %d completions, want %d", n, NPAGES + 2);
+
+	for (i = 0; i < NPAGES; i++)
+		*(int *) (UTEMP + i * PGSIZE) = i;
+
+	// The ring stays shared with the kernel after a fork.
+	if ((res = fork()) < 0)
+		panic("fork: %i", res);
+	if (res == 0)
+		exit();
+	wait(res);
+	sysring_prep(r, SYS_getenvid, 0, 0, 0, 0, 0, 0);
+	if ((res = sysring_submit(r, 1)) != 1)
+		panic("sysring_submit after fork: %i, want 1", res);
+	if (!sysring_reap(r, &cqe) || cqe.cqe_res != thisenv->env_id)
+		panic("getenvid after fork: %08x, want %08x", cqe.cqe_res, thisenv->env_id);
+
+	cprintf("sysring ok\n");
+}
@@ -0,0 +1,68 @@
+// Change the mappings of an env running on another CPU, and check
+// that it sees the change.  Run with CPUS=2 or more: then the page
+// syscalls of the two envs also run in parallel, without the BKL.
+
+#include <inc/lib.h>
+
+#define VA	((volatile int *) 0xA0000000)
+#define FLAG	((volatile int *) 0xA0001000)
+#define NLOOP	200
+
+// Allocate and free pages in the calling env's own address space.
+static void
+churn(void)
+{
+	int i, r;
+
+	for (i = 0; i < NLOOP; i++) {
+		if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+			panic("sys_page_alloc: %i", r);
+		*(int *) UTEMP = i;
+		if ((r = sys_page_unmap(0, UTEMP)) < 0)
+			panic("sys_page_unmap: %i", r);
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+	envid_t child;
+	uint64_t start;
+	int r;
+
+	if ((r = sys_page_alloc(0, (void *) FLAG, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %i", r);
+	if ((r = sys_page_alloc(0, (void *) VA, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("sys_page_alloc: %i", r);
+	*VA = 1;
+
+	if ((child = fork()) < 0)
+		panic("fork: %i", child);
+	if (child == 0) {
+		churn();
+		// Get VA into the TLB, then wait for the parent to
+		// replace the page behind it.
+		if (*VA != 1)
+			panic("child: VA reads %d before the change", *VA);
+		*FLAG = 1;
+		start = vsys_monotonic_ns();
+		while (*VA == 1)
+			if (vsys_monotonic_ns() - start > 2000000000ULL)
+				panic("child: stale TLB entry for VA");
+		cprintf("tlb shootdown ok\n");
+		return;
+	}
+
+	churn();
+	while (*FLAG == 0)
+		sys_yield();
+	if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("sys_page_alloc: %i", r);
+	*(int *) UTEMP = 2;
+	if ((r = sys_page_map(0, UTEMP, child, (void *) VA, PTE_P | PTE_U)) < 0)
+		panic("sys_page_map: %i", r);
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+		panic("sys_page_unmap: %i", r);
+	wait(child);
+	cprintf("parallel page syscalls ok\n");
+}
@@ -0,0 +1,31 @@
+// Read the high-resolution clock of the vsys page.
+
+#include <inc/lib.h>
+
+#define ROUNDS	1000
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t prev, now, wall;
+	uint32_t i;
+
+	prev = vsys_monotonic_ns();
+	for (i = 0; i < ROUNDS; i++) {
+		now = vsys_monotonic_ns();
+		if (now < prev)
+			panic("monotonic clock went back from %llu to %llu",
+			      prev, now);
+		prev = now;
+	}
+
+	// The two wall clocks agree to within the tick that last
+	// updated vsys_gettime.
+	wall = vsys_wallclock_ns() / 1000000000;
+	if (wall + 1 < vsys_gettime() || wall > vsys_gettime() + 1)
+		panic("wall clock %llu s, vsys_gettime %d s",
+		      wall, vsys_gettime());
+
+	cprintf("vclock: TSC %u kHz, %llu ns since boot, %u ticks\n",
+		vsys_tsc_khz(), vsys_monotonic_ns(), vsys_ticks());
+}